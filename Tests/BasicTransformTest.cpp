@@ -0,0 +1,51 @@
+#include <algorithm>
+#include "TestCommon.hpp"
+#include "BasicTransform.hpp"
+
+//
+// BasicTransform : eq̉
+//
+
+// jꂽe̎q́A[hsێ܂ܐeɂȂ
+static void TestDestroyParent()
+{
+    TranslationTransform child;
+    {
+        TranslationTransform parent;
+        parent.SetLocalLocation(1.0f, 2.0f, 3.0f);
+        child.BecomeParents(&parent);
+        child.SetLocalLocation(1.0f, 0.0f, 0.0f);
+    }
+
+    TEST_CHECK(!child.HasParent());
+    TEST_CHECK(IsNear(child.GetWorldLocation(), D3DXVECTOR3(2.0f, 2.0f, 3.0f)));
+
+    // [Js[hsɑĂ
+    child.SetLocalLocation(5.0f, 0.0f, 0.0f);
+    TEST_CHECK(IsNear(child.GetWorldLocation(), D3DXVECTOR3(5.0f, 0.0f, 0.0f)));
+}
+
+// jꂽq͐e̎q̔z񂩂
+static void TestDestroyChild()
+{
+    RigidTransform parent;
+    RigidTransform first(&parent), last(&parent);
+    {
+        RigidTransform middle(&parent);
+    }
+
+    const auto& children = parent.GetChildren();
+    TEST_CHECK(children.size() == 2 && children[0] == &first && children[1] == &last);
+
+    // e𓮂Ăqɂ͐GȂ
+    parent.SetLocalLocation(1.0f, 0.0f, 0.0f);
+    TEST_CHECK(IsNear(last.GetWorldLocation(), D3DXVECTOR3(1.0f, 0.0f, 0.0f)));
+}
+
+int main()
+{
+    TestDestroyParent();
+    TestDestroyChild();
+
+    return TestResult("BasicTransformTest");
+}
\ No newline at end of file
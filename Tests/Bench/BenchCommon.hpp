@@ -0,0 +1,40 @@
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#pragma once
+
+//
+// x`}[N̏
+// ŌvA--quick ȂK͂ēm߂ ( ctest p )
+// v͍œKrh ( -DCMAKE_BUILD_TYPE=Release ) ōs
+//
+
+// --quick w肳ꂽ
+inline bool IsQuickRun(int argc, char** argv)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::strcmp(argv[i], "--quick") == 0) return true;
+	}
+	return false;
+}
+
+// 񂩌vĈԑ̕b ( 荞݂Ȃǂ̗h )
+template<class Function>
+double MeasureBest(int repeat, Function&& function)
+{
+	double best = 1e30;
+	for (int i = 0; i < repeat; i++)
+	{
+		const auto begin = std::chrono::steady_clock::now();
+		function();
+		const auto end = std::chrono::steady_clock::now();
+
+		best = std::min(best, std::chrono::duration<double>(end - begin).count());
+	}
+	return best;
+}
+
+// vZœKŏȂ悤Ɍʂo
+inline volatile float benchSink = 0.0f;
\ No newline at end of file
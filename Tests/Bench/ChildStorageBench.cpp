@@ -0,0 +1,90 @@
+#include <vector>
+#include <memory>
+#include <new>
+#include <cstdlib>
+#include "BenchCommon.hpp"
+#include "Transform.hpp"
+
+//
+// q̔z Transform ̒Ɏ ( TRANSFORM_INLINE_CHILD_CAPACITY )
+// q 0 ` 3 m[hƂ̃q[vmۂ̉񐔂Astd::vector<Transform*>  push_back ꍇƔׂ
+//
+
+namespace
+{
+    // q[vmۂ̉ ( Ŝ operator new uĐ )
+    size_t allocationCount = 0;
+}
+
+void* operator new(size_t size)
+{
+    allocationCount++;
+    if (void* const p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+int main(int argc, char** argv)
+{
+    const bool   bQuick  = IsQuickRun(argc, argv);
+    const size_t parents = bQuick ? 1000 : 100000;
+    const int    repeat  = bQuick ? 1 : 5;
+
+    std::printf("ChildStorageBench ( %zu parents, inline capacity %d )\n", parents, TRANSFORM_INLINE_CHILD_CAPACITY);
+
+    bool bOk = true;
+    for (size_t childCount = 0; childCount <= 3; childCount++)
+    {
+        // m[hg͐ɂ܂Ƃ߂ĊmۂĂAeqgނƂ̊mۂ
+        std::unique_ptr<Transform[]> parentNodes(new Transform[parents]);
+        std::unique_ptr<Transform[]> childNodes(new Transform[parents * childCount + 1]);
+
+        const size_t before = allocationCount;
+        for (size_t p = 0; p < parents; p++)
+        {
+            for (size_t c = 0; c < childCount; c++) childNodes[p * childCount + c].BecomeParents(&parentNodes[p]);
+        }
+        const size_t transformAllocations = allocationCount - before;
+
+        // r : q̔z std::vector Ŏꍇ
+        std::vector<std::vector<Transform*>> vectors(parents);
+        const size_t vectorBefore = allocationCount;
+        for (size_t p = 0; p < parents; p++)
+        {
+            for (size_t c = 0; c < childCount; c++) vectors[p].push_back(&childNodes[p * childCount + c]);
+        }
+        const size_t vectorAllocations = allocationCount - vectorBefore;
+
+        // gŊO ( mۂ̗L̍o )
+        const double seconds = MeasureBest(repeat, [&]()
+        {
+            for (size_t p = 0; p < parents; p++) parentNodes[p].DetachAllChildren(false);
+            for (size_t p = 0; p < parents; p++)
+            {
+                for (size_t c = 0; c < childCount; c++) childNodes[p * childCount + c].BecomeParents(&parentNodes[p]);
+            }
+        });
+
+        std::printf("  %zu children : Transform %.2f allocations / parent, std::vector %.2f allocations / parent, relink %6.1f ns / parent\n",
+            childCount,
+            static_cast<double>(transformAllocations) / parents,
+            static_cast<double>(vectorAllocations)    / parents,
+            seconds * 1e9 / parents);
+
+        // Ɏ܂鐔ȂmۂȂ
+        if (childCount <= TRANSFORM_INLINE_CHILD_CAPACITY && transformAllocations != 0) bOk = false;
+    }
+
+    std::printf("  no allocation within inline capacity : %s\n", bOk ? "ok" : "NG");
+
+    return bOk ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include <vector>
+#include <memory>
+#include "BenchCommon.hpp"
+#include "Transform.hpp"
+
+//
+// [ (  100k i ) ̓`d
+// ċAȂ̂ŒiɊւ炸X^bNȂ ( ċAĂ 20k iOŃX^bNĂ )
+//
+
+int main(int argc, char** argv)
+{
+    const bool   bQuick = IsQuickRun(argc, argv);
+    const size_t depth  = bQuick ? 1000 : 100000;
+    const int    repeat = bQuick ? 1 : 10;
+
+    // x̏z`FbNőgݗĂ (  BecomeParents() Ɛc̊mF O(n^2) )
+    std::unique_ptr<Transform[]> nodes(new Transform[depth]);
+    std::vector<Transform*>      transforms(depth);
+    std::vector<int>             parentIndices(depth);
+    std::vector<D3DXMATRIX>      localMatrices(depth);
+
+    for (size_t i = 0; i < depth; i++)
+    {
+        transforms[i]    = &nodes[i];
+        parentIndices[i] = static_cast<int>(i) - 1;
+        D3DXMatrixTranslation(&localMatrices[i], 0.0f, 0.001f, 0.0f);
+    }
+
+    Transform::BuildHierarchy(transforms, parentIndices, localMatrices);
+
+    Transform& root = nodes[0];
+    Transform& leaf = nodes[depth - 1];
+
+    // 𓮂čŜ`d ( UpdateWorldMatrix() ̌oH )
+    float x = 0.0f;
+    const double propagate = MeasureBest(repeat, [&]()
+    {
+        x += 1.0f;
+        root.SetLocalLocation(x, 0.0f, 0.0f);
+    });
+    benchSink = leaf.GetWorldMatrix()._41;
+
+    // 𔽉fɓAtoHvZ ( ComputeWorldMatrixNow() ̌oH )
+    const double computeNow = MeasureBest(repeat, [&]()
+    {
+        x += 1.0f;
+        root.SetLocalLocation(x, 0.0f, 0.0f, false);
+        benchSink = leaf.ComputeWorldMatrixNow()._41;
+    });
+    root.UpdateWorldMatrix();
+
+    // ̃[hsĎq`d ( UpdateLocalMatrix() ̌oH )
+    const double updateLocal = MeasureBest(repeat, [&]()
+    {
+        x += 1.0f;
+        root.SetWorldLocation(x, 0.0f, 0.0f);
+    });
+    benchSink = leaf.GetWorldMatrix()._41;
+
+    std::printf("DeepChainBench : depth %zu\n", depth);
+    std::printf("  propagate from root    : %8.3f ms ( %6.2f ns / level )\n", propagate   * 1e3, propagate   * 1e9 / depth);
+    std::printf("  ComputeWorldMatrixNow  : %8.3f ms ( %6.2f ns / level )\n", computeNow  * 1e3, computeNow  * 1e9 / depth);
+    std::printf("  world write + local    : %8.3f ms ( %6.2f ns / level )\n", updateLocal * 1e3, updateLocal * 1e9 / depth);
+
+    // ҂ʒu ( `drŎ~܂ĂȂ )
+    const bool bOk = leaf.GetWorldMatrix()._41 == x;
+    std::printf("  leaf follows root      : %s\n", bOk ? "ok" : "NG");
+
+    return bOk ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include <vector>
+#include <numeric>
+#include <random>
+#include <algorithm>
+#include <chrono>
+#include "BenchCommon.hpp"
+#include "TransformArena.hpp"
+
+//
+// TransformArena ̕בւ̑OŁA̓`dׂ̑
+//  ( 4  ) ̈ʒuƃA[ïʒȗΉ𗐐ōāA쐬ƔjJԂ̂悤ȕт
+//
+
+namespace
+{
+    // ؂̈ʒu k ̃m[h handles[order[k]] ɂđgݗĂ
+    std::vector<TransformHandle> BuildTree(TransformArena* const arena, size_t count, bool bShuffle)
+    {
+        std::vector<TransformHandle> handles(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            handles[i] = arena->Create();
+        }
+
+        std::vector<size_t> order(count);
+        std::iota(order.begin(), order.end(), size_t(0));
+        if (bShuffle)
+        {
+            std::mt19937 random(1234);
+            std::shuffle(order.begin() + 1, order.end(), random);
+        }
+
+        std::vector<Transform*>      transforms(count);
+        std::vector<int>             parentIndices(count);
+        std::vector<D3DXMATRIX>      localMatrices(count);
+        std::vector<TransformHandle> treeHandles(count);
+        for (size_t k = 0; k < count; k++)
+        {
+            treeHandles[k]   = handles[order[k]];
+            transforms[k]    = arena->Get(treeHandles[k]);
+            parentIndices[k] = (k == 0) ? -1 : static_cast<int>((k - 1) / 4);
+            D3DXMatrixTranslation(&localMatrices[k], 0.0f, 1.0f, 0.0f);
+        }
+
+        Transform::BuildHierarchy(transforms, parentIndices, localMatrices);
+
+        return treeHandles;
+    }
+
+    // ̓`d 1 m[h̎ ( ns )
+    double MeasurePropagation(const TransformArena& arena, const std::vector<TransformHandle>& treeHandles, int repeat)
+    {
+        Transform* const root = arena.Get(treeHandles[0]);
+
+        float x = 0.0f;
+        const double seconds = MeasureBest(repeat, [&]()
+        {
+            x += 1.0f;
+            root->SetLocalLocation(x, 0.0f, 0.0f);
+        });
+        benchSink = arena.Get(treeHandles.back())->GetWorldMatrix()._41;
+
+        return seconds * 1e9 / treeHandles.size();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const bool   bQuick   = IsQuickRun(argc, argv);
+    const int    repeat   = bQuick ? 1 : 10;
+    const size_t count    = bQuick ? 4096 : size_t(1) << 19;
+    const size_t maxMoves = 1024;
+
+    std::printf("DefragmentBench ( %zu nodes )\n", count);
+
+    // e珇ɍꍇ
+    {
+        TransformArena arena(count);
+        const std::vector<TransformHandle> treeHandles = BuildTree(&arena, count, false);
+        std::printf("  created in tree order : %6.2f ns / node\n", MeasurePropagation(arena, treeHandles, repeat));
+    }
+
+    //  -> Defragment()
+    {
+        TransformArena arena(count);
+        const std::vector<TransformHandle> treeHandles = BuildTree(&arena, count, true);
+        std::printf("  fragmented            : %6.2f ns / node\n", MeasurePropagation(arena, treeHandles, repeat));
+
+        arena.Defragment();
+        std::printf("  after Defragment()    : %6.2f ns / node\n", MeasurePropagation(arena, treeHandles, repeat));
+
+        if (!arena.IsDefragmented())
+        {
+            std::printf("  FAIL : not defragmented\n");
+            return 1;
+        }
+    }
+
+    //  -> DefragmentStep() ؂ČĂ
+    {
+        TransformArena arena(count);
+        const std::vector<TransformHandle> treeHandles = BuildTree(&arena, count, true);
+
+        size_t steps   = 0;
+        double total   = 0.0;
+        double longest = 0.0;
+        for (bool bDone = false; !bDone; steps++)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            bDone = arena.DefragmentStep(maxMoves);
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+            total  += seconds;
+            longest = std::max(longest, seconds);
+        }
+
+        std::printf("  DefragmentStep(%zu)  : %zu steps, %.3f ms average, %.3f ms longest\n",
+            maxMoves, steps, total * 1e3 / steps, longest * 1e3);
+        std::printf("  after DefragmentStep  : %6.2f ns / node\n", MeasurePropagation(arena, treeHandles, repeat));
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include <vector>
+#include <memory>
+#include "BenchCommon.hpp"
+#include "Transform.hpp"
+
+//
+// `dŐGf[^ 1 m[h 192 byte ɋl߂
+// rpɁA߂ɎgȂLbV ( tsA@p̍sAA΍s ) 
+// m[h̒ɎĂƓ傫hNXŁA؂`d
+// LbV~X̐ perf stat -e cache-misses,cache-references ./HotColdLayoutBench Ő
+//
+
+// Ȏ傫Č ( s 3  +  2  + łȂ )
+class InlineCacheTransform : public Transform
+{
+public:
+    unsigned char inlineCache[3 * sizeof(D3DXMATRIX) + 2 * sizeof(Transform::Basis) + 32] = {};
+};
+
+// 4 ؂𕝗D̏ɕׂđgݗāA̓`dv
+template<class Node>
+double MeasurePropagation(size_t count, int repeat)
+{
+    std::unique_ptr<Node[]> nodes(new Node[count]);
+    std::vector<Transform*> transforms(count);
+    std::vector<int>        parentIndices(count);
+    std::vector<D3DXMATRIX> localMatrices(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        transforms[i]    = &nodes[i];
+        parentIndices[i] = (i == 0) ? -1 : static_cast<int>((i - 1) / 4);
+        D3DXMatrixTranslation(&localMatrices[i], 0.0f, 1.0f, 0.0f);
+    }
+
+    Transform::BuildHierarchy(transforms, parentIndices, localMatrices);
+
+    float x = 0.0f;
+    const double seconds = MeasureBest(repeat, [&]()
+    {
+        x += 1.0f;
+        nodes[0].SetLocalLocation(x, 0.0f, 0.0f);
+    });
+    benchSink = nodes[count - 1].GetWorldMatrix()._41;
+
+    return seconds;
+}
+
+int main(int argc, char** argv)
+{
+    const bool bQuick = IsQuickRun(argc, argv);
+    const int  repeat = bQuick ? 1 : 10;
+
+    std::printf("HotColdLayoutBench\n");
+    std::printf("  sizeof(Transform)            : %zu byte ( budget 192 )\n", sizeof(Transform));
+    std::printf("  sizeof(InlineCacheTransform) : %zu byte\n", sizeof(InlineCacheTransform));
+
+    // LbVɎ܂鐔Ǝ܂Ȃ
+    const size_t counts[] = { bQuick ? size_t(1024) : size_t(4096), bQuick ? size_t(4096) : size_t(1) << 19 };
+
+    for (const size_t count : counts)
+    {
+        const double hot  = MeasurePropagation<Transform>(count, repeat);
+        const double fat  = MeasurePropagation<InlineCacheTransform>(count, repeat);
+
+        std::printf("  %7zu nodes : split %6.2f ns / node ( %5.1f MB ), inline caches %6.2f ns / node ( %5.1f MB ), %.2fx\n",
+            count,
+            hot * 1e9 / count, count * sizeof(Transform)            / 1048576.0,
+            fat * 1e9 / count, count * sizeof(InlineCacheTransform) / 1048576.0,
+            fat / hot);
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include <vector>
+#include <memory>
+#include <cmath>
+#include "BenchCommon.hpp"
+#include "Transform.hpp"
+
+//
+// GetRelativeMatrix() ƃ[hsoR@ ( from ̃[hs * to ̃[hts ) ̔r
+//  ( ĂяõLbV / Ȃ ) ƁA_牓ꏊł̌덷 ( double ŌvZlƂ̍ )
+//
+
+namespace
+{
+    // double  4x4 s ( 덷̊ )
+    struct Matrix4d
+    {
+        double m[4][4];
+    };
+
+    Matrix4d ToDouble(const D3DXMATRIX& matrix)
+    {
+        Matrix4d result;
+        for (int r = 0; r < 4; r++)
+        {
+            for (int c = 0; c < 4; c++) result.m[r][c] = matrix.m[r][c];
+        }
+        return result;
+    }
+
+    Matrix4d Multiply(const Matrix4d& a, const Matrix4d& b)
+    {
+        Matrix4d result = {};
+        for (int r = 0; r < 4; r++)
+        {
+            for (int c = 0; c < 4; c++)
+            {
+                for (int k = 0; k < 4; k++) result.m[r][c] += a.m[r][k] * b.m[k][c];
+            }
+        }
+        return result;
+    }
+
+    // |o@ ( s{bg )
+    Matrix4d Inverse(const Matrix4d& matrix)
+    {
+        Matrix4d a      = matrix;
+        Matrix4d result = {};
+        for (int i = 0; i < 4; i++) result.m[i][i] = 1.0;
+
+        for (int c = 0; c < 4; c++)
+        {
+            int pivot = c;
+            for (int r = c + 1; r < 4; r++)
+            {
+                if (std::fabs(a.m[r][c]) > std::fabs(a.m[pivot][c])) pivot = r;
+            }
+            std::swap(a.m[c], a.m[pivot]);
+            std::swap(result.m[c], result.m[pivot]);
+
+            const double inv = 1.0 / a.m[c][c];
+            for (int k = 0; k < 4; k++) { a.m[c][k] *= inv; result.m[c][k] *= inv; }
+
+            for (int r = 0; r < 4; r++)
+            {
+                if (r == c) continue;
+                const double factor = a.m[r][c];
+                for (int k = 0; k < 4; k++) { a.m[r][k] -= factor * a.m[c][k]; result.m[r][k] -= factor * result.m[c][k]; }
+            }
+        }
+        return result;
+    }
+
+    // [hs ( ܂ double Ŋ| )
+    Matrix4d WorldDouble(const Transform* node)
+    {
+        Matrix4d world = ToDouble(node->GetLocalMatrix());
+        for (node = node->GetParent(); node; node = node->GetParent()) world = Multiply(world, ToDouble(node->GetLocalMatrix()));
+        return world;
+    }
+
+    // ԑ傫vf̍
+    double MaxError(const D3DXMATRIX& matrix, const Matrix4d& reference)
+    {
+        double error = 0.0;
+        for (int r = 0; r < 4; r++)
+        {
+            for (int c = 0; c < 4; c++) error = std::max(error, std::fabs(matrix.m[r][c] - reference.m[r][c]));
+        }
+        return error;
+    }
+
+    // [hsoR@
+    D3DXMATRIX RelativeByWorld(const Transform& from, const Transform& to)
+    {
+        D3DXMATRIX inverse, result;
+        D3DXMatrixInverse(&inverse, nullptr, &to.GetWorldMatrix());
+        D3DXMatrixMultiply(&result, &from.GetWorldMatrix(), &inverse);
+        return result;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const bool   bQuick      = IsQuickRun(argc, argv);
+    const int    repeat      = bQuick ? 1 : 5;
+    const int    queries     = bQuick ? 1000 : 1000000;
+    const size_t branchDepth = 6;
+
+    // _牓̉ɁA]} 3 {
+    D3DXMATRIX rootMatrix;
+    D3DXMatrixTranslation(&rootMatrix, 100000.0f, 20000.0f, -30000.0f);
+    Transform root(nullptr, &rootMatrix);
+
+    std::vector<std::unique_ptr<Transform>> nodes;
+    Transform* leaves[3] = {};
+    for (int branch = 0; branch < 3; branch++)
+    {
+        Transform* parent = &root;
+        for (size_t i = 0; i < branchDepth; i++)
+        {
+            D3DXMATRIX local;
+            D3DXMatrixRotationYawPitchRoll(&local, 0.1f * (branch + 1), 0.05f * i, 0.02f);
+            local._41 = 0.5f * (branch + 1);
+            local._42 = 0.25f;
+            local._43 = 0.125f * i;
+
+            nodes.push_back(std::make_unique<Transform>(parent, &local));
+            parent = nodes.back().get();
+        }
+        leaves[branch] = parent;
+    }
+
+    const Transform& from = *leaves[0];
+    const Transform& to   = *leaves[1];
+    const Transform& to2  = *leaves[2];
+
+    std::printf("RelativeMatrixBench ( 2 x %zu levels below the common ancestor, root at (1e5, 2e4, -3e4) )\n", branchDepth);
+
+    // 
+    const double world = MeasureBest(repeat, [&]()
+    {
+        for (int i = 0; i < queries; i++) benchSink = RelativeByWorld(from, to)._41;
+    });
+
+    const double noCache = MeasureBest(repeat, [&]()
+    {
+        for (int i = 0; i < queries; i++) benchSink = Transform::GetRelativeMatrix(&from, &to)._41;
+    });
+
+    Transform::RelativeMatrixCache cache;
+    const double cached = MeasureBest(repeat, [&]()
+    {
+        for (int i = 0; i < queries; i++) benchSink = Transform::GetRelativeMatrix(&from, &to, &cache)._41;
+    });
+
+    // ̃LbV to ݂ɕςƖO
+    const double alternating = MeasureBest(repeat, [&]()
+    {
+        for (int i = 0; i < queries; i++) benchSink = Transform::GetRelativeMatrix(&from, (i & 1) ? &to : &to2, &cache)._41;
+    });
+
+    std::printf("  world route          : %7.2f ns / query\n", world       * 1e9 / queries);
+    std::printf("  relative, no cache   : %7.2f ns / query\n", noCache     * 1e9 / queries);
+    std::printf("  relative, cache hit  : %7.2f ns / query\n", cached      * 1e9 / queries);
+    std::printf("  relative, cache miss : %7.2f ns / query ( alternating targets )\n", alternating * 1e9 / queries);
+
+    // 덷
+    const Matrix4d reference = Multiply(WorldDouble(&from), Inverse(WorldDouble(&to)));
+    const double   worldError    = MaxError(RelativeByWorld(from, to), reference);
+    const double   relativeError = MaxError(Transform::GetRelativeMatrix(&from, &to), reference);
+
+    std::printf("  max error vs double  : world route %.3e, relative %.3e\n", worldError, relativeError);
+
+    return (relativeError <= worldError) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include <vector>
+#include <cmath>
+#include "BenchCommon.hpp"
+#include "Transform.hpp"
+
+//
+// ꊇϊ ( TransformPoints() Ȃ )  Mvertices/sec
+//  D3DXVec3TransformCoord Ăԃ[v ( ̃rhł̓X^u̎Ȃ̂ŁA@ D3DX Ƃ͑Ⴄ )
+//
+
+int main(int argc, char** argv)
+{
+    const bool   bQuick = IsQuickRun(argc, argv);
+    const size_t count  = bQuick ? 1000 : 1000000;
+    const int    repeat = bQuick ? 1 : 10;
+
+    // ʓIȃ[hs ( ] + ψgk + sړ )
+    Transform transform;
+    transform.SetLocalRotation(0.3f, 0.2f, 0.1f);
+    transform.SetLocalScale(1.0f, 2.0f, 3.0f);
+    transform.SetLocalLocation(10.0f, 20.0f, 30.0f);
+    const D3DXMATRIX& world = transform.GetWorldMatrix();
+
+    std::vector<D3DXVECTOR3> points(count), out(count), expected(count);
+    std::vector<float> x(count), y(count), z(count), outX(count), outY(count), outZ(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        points[i] = D3DXVECTOR3(std::sin(i * 0.1f), std::cos(i * 0.2f), i * 0.001f);
+        x[i] = points[i].x;
+        y[i] = points[i].y;
+        z[i] = points[i].z;
+    }
+
+    const double reference = MeasureBest(repeat, [&]()
+    {
+        for (size_t i = 0; i < count; i++) D3DXVec3TransformCoord(&expected[i], &points[i], &world);
+    });
+
+    const double aos = MeasureBest(repeat, [&]()
+    {
+        transform.TransformPoints(points, out);
+    });
+
+    // Ƃ̍
+    float error = 0.0f;
+    for (size_t i = 0; i < count; i++)
+    {
+        const D3DXVECTOR3 diff = out[i] - expected[i];
+        error = std::max(error, std::max(std::fabs(diff.x), std::max(std::fabs(diff.y), std::fabs(diff.z))));
+    }
+
+    const double soa = MeasureBest(repeat, [&]()
+    {
+        transform.TransformPoints(x, y, z, outX, outY, outZ);
+    });
+
+    const double directionsAos = MeasureBest(repeat, [&]()
+    {
+        transform.TransformDirections(points, out);
+    });
+
+    const double directionsSoa = MeasureBest(repeat, [&]()
+    {
+        transform.TransformDirections(x, y, z, outX, outY, outZ);
+    });
+
+    const double inverseAos = MeasureBest(repeat, [&]()
+    {
+        transform.InverseTransformPoints(points, out);
+    });
+    benchSink = out[count - 1].x + outX[count - 1];
+
+    auto print = [count](const char* name, double seconds)
+    {
+        std::printf("  %-27s : %8.1f Mvertices/sec\n", name, count / seconds * 1e-6);
+    };
+
+    std::printf("TransformPointsBench ( %zu vertices )\n", count);
+    print("D3DXVec3TransformCoord loop", reference);
+    print("TransformPoints AoS",         aos);
+    print("TransformPoints SoA",         soa);
+    print("TransformDirections AoS",     directionsAos);
+    print("TransformDirections SoA",     directionsSoa);
+    print("InverseTransformPoints AoS",  inverseAos);
+    std::printf("  %-27s : %.3e\n", "max difference from loop", error);
+
+    return (error <= 1e-3f) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include "TestCommon.hpp"
+#include "RotationArray.hpp"
+
+//
+// RotationArray : zŜ̉Z Rotation ̓Zƈv邩
+// vf AVX2 ( 8  )ASSE2 ( 4  )A[ ( 1  ) ̑SĂ̌oHʂ悤ɑI
+//
+
+// Ő܂Ԃpx̍ ( -unit  +unit ͓ )
+static float AngleDifference(float a, float b, float unit)
+{
+    const double period = 2.0 * unit;
+    double difference = std::fmod(static_cast<double>(a) - b, period);
+    if (difference >  unit) difference -= period;
+    if (difference < -unit) difference += period;
+    return static_cast<float>(std::fabs(difference));
+}
+
+// Normalize()  Rotation::Normalize() / GetNormal() ƁAwb_[ɏ덷͈̔͂ňv
+static void TestNormalizeMatchesRotation()
+{
+    for (const bool degree : { false, true })
+    {
+        const float unit  = degree ? 180.0f : D3DX_PI;
+        const float limit = degree ? 1e6f : 1e4f;
+
+        RotationArray array;
+        std::vector<Rotation> rotations;
+        for (int i = -1000; i <= 1000; i++)
+        {
+            const float value = limit * i / 1000.0f + 0.37f * i;
+            rotations.push_back(Rotation(value, -0.7f * value, unit * i));
+            array.PushBack(rotations.back());
+        }
+
+        array.Normalize(degree);
+
+        float worst = 0.0f;
+        for (size_t i = 0; i < rotations.size(); i++)
+        {
+            const Rotation expected = rotations[i].GetNormal(degree);
+            Rotation normalized = rotations[i];
+            normalized.Normalize(degree);
+
+            const Rotation result = array.Get(i);
+            const float    source[3]    = { rotations[i].yaw, rotations[i].pitch, rotations[i].roll };
+            const float    actual[3]    = { result.yaw,       result.pitch,       result.roll };
+            const float    reference[3] = { expected.yaw,     expected.pitch,     expected.roll };
+
+            for (int c = 0; c < 3; c++)
+            {
+                const float tolerance = (std::fabs(source[c]) + 2 * unit) * RotationArray::NormalizeRelativeError;
+                const float error     = AngleDifference(actual[c], reference[c], unit);
+
+                TEST_CHECK(error <= tolerance);
+                TEST_CHECK(std::fabs(actual[c]) <= unit + tolerance);
+                worst = std::max(worst, error / tolerance);
+            }
+
+            TEST_CHECK(normalized.yaw == expected.yaw && normalized.pitch == expected.pitch && normalized.roll == expected.roll);
+        }
+
+        std::printf("  Normalize(%s) : worst error %.2f of tolerance\n", degree ? "degree" : "radian", worst);
+    }
+}
+
+// l͂ǂ̌oH ( AVX2ASSE2A[ ) łʂɂȂ ( 2^31 𒴂l )
+static void TestNormalizePathsAgree()
+{
+    const float values[] = { 0.0f, 5.0f, -5.0f, D3DX_PI, -D3DX_PI, 1e7f, -3e9f, 3e9f, 1e20f, -1e30f };
+
+    for (const float value : values)
+    {
+        for (const bool degree : { false, true })
+        {
+            RotationArray array(23);
+            for (size_t i = 0; i < array.GetSize(); i++) array.Set(i, Rotation(value, value, value));
+
+            array.Normalize(degree);
+
+            const Rotation first = array.Get(0);
+            for (size_t i = 1; i < array.GetSize(); i++)
+            {
+                const Rotation result = array.Get(i);
+                TEST_CHECK(std::memcmp(&result, &first, sizeof(Rotation)) == 0);
+            }
+        }
+    }
+}
+
+// ZAgkAԂ Rotation ̉ZƓl
+static void TestArithmeticMatchesRotation()
+{
+    std::vector<Rotation> a, b;
+    for (int i = 0; i < 23; i++)
+    {
+        a.push_back(Rotation(0.1f * i, -0.2f * i, 0.3f * i));
+        b.push_back(Rotation(1.0f - 0.05f * i, 0.5f, -0.25f * i));
+    }
+
+    RotationArray arrayA(a), arrayB(b);
+    arrayA.Add(arrayB);
+    arrayA.Scale(0.5f);
+    arrayA.Lerp(arrayB, 0.25f);
+
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        Rotation expected = a[i];
+        expected += b[i];
+        expected *= 0.5f;
+        expected = expected + (b[i] - expected) * 0.25f;
+
+        const Rotation result = arrayA.Get(i);
+        TEST_CHECK(IsNear(result.yaw, expected.yaw, 1e-6f) && IsNear(result.pitch, expected.pitch, 1e-6f) && IsNear(result.roll, expected.roll, 1e-6f));
+    }
+}
+
+int main()
+{
+    TestNormalizeMatchesRotation();
+    TestNormalizePathsAgree();
+    TestArithmeticMatchesRotation();
+
+    return TestResult("RotationArrayTest");
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#include "TestCommon.hpp"
+#include "SkinningPalette.hpp"
+
+//
+// SkinningPalette : pbg̒g CPU Ŋm߂
+//
+
+// bṼ[gOƁA Update() Ń[hs̊ɖ߂
+static void TestClearMeshRoot()
+{
+    Transform skeleton;
+    Transform bone(&skeleton);
+    Transform meshRoot;
+    meshRoot.SetWorldLocation(10.0f, 0.0f, 0.0f);
+
+    SkinningPalette palette(&skeleton);
+    TEST_CHECK(palette.CollectBones() == 2);
+
+    // ̎poCh|[YȂ̂ŁAXLs̓bṼ[g̋ts
+    palette.SetMeshRoot(&meshRoot);
+    palette.Update();
+    TEST_CHECK(IsNear(palette.GetMatrices()[0]._41, -10.0f));
+
+    palette.SetMeshRoot(nullptr);
+    TEST_CHECK(palette.Update() == 2);
+    TEST_CHECK(IsNear(palette.GetMatrices()[0]._41, 0.0f));
+}
+
+// ς{[vZ
+static void TestUpdateChangedBones()
+{
+    Transform skeleton;
+    Transform bone(&skeleton);
+
+    SkinningPalette palette(&skeleton);
+    palette.CollectBones();
+    palette.Update();
+    TEST_CHECK(palette.Update() == 0);
+
+    bone.SetLocalLocation(0.0f, 1.0f, 0.0f);
+    TEST_CHECK(palette.Update() == 1);
+    TEST_CHECK(IsNear(palette.GetMatrices()[1]._42, 1.0f));
+}
+
+int main()
+{
+    TestClearMeshRoot();
+    TestUpdateChangedBones();
+
+    return TestResult("SkinningPaletteTest");
+}
\ No newline at end of file
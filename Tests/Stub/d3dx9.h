@@ -0,0 +1,292 @@
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#pragma once
+
+//
+// eXgp d3dx9.h ̑ ( DirectX SDK ̖ CPU ŃeXg邽 )
+// Cug^Ɗ֐AD3DX ƓK ( sxNgAn ) Ŏ
+//
+
+typedef int BOOL;
+typedef unsigned int UINT;
+typedef unsigned long DWORD;
+typedef float FLOAT;
+typedef long HRESULT;
+#define TRUE 1
+#define FALSE 0
+#define D3DX_PI 3.141592654f
+#define D3D_OK 0
+
+// libstdc++  std::fabsf ȂǂȂ̂ŕ₤
+namespace std { using ::fabsf; using ::asinf; using ::atan2f; }
+
+struct D3DXVECTOR3
+{
+	float x, y, z;
+	D3DXVECTOR3() {}
+	D3DXVECTOR3(float x, float y, float z) : x(x), y(y), z(z) {}
+	D3DXVECTOR3 operator+(const D3DXVECTOR3& v) const { return {x+v.x, y+v.y, z+v.z}; }
+	D3DXVECTOR3 operator-(const D3DXVECTOR3& v) const { return {x-v.x, y-v.y, z-v.z}; }
+	D3DXVECTOR3 operator*(float f) const { return {x*f, y*f, z*f}; }
+	D3DXVECTOR3 operator/(float f) const { return {x/f, y/f, z/f}; }
+	D3DXVECTOR3 operator-() const { return {-x, -y, -z}; }
+	D3DXVECTOR3& operator+=(const D3DXVECTOR3& v) { x+=v.x; y+=v.y; z+=v.z; return *this; }
+	D3DXVECTOR3& operator-=(const D3DXVECTOR3& v) { x-=v.x; y-=v.y; z-=v.z; return *this; }
+	D3DXVECTOR3& operator*=(float f) { x*=f; y*=f; z*=f; return *this; }
+	D3DXVECTOR3& operator/=(float f) { x/=f; y/=f; z/=f; return *this; }
+	bool operator==(const D3DXVECTOR3& v) const { return x==v.x && y==v.y && z==v.z; }
+	bool operator!=(const D3DXVECTOR3& v) const { return !(*this == v); }
+	operator float*() { return &x; }
+	operator const float*() const { return &x; }
+};
+inline D3DXVECTOR3 operator*(float f, const D3DXVECTOR3& v) { return v * f; }
+
+struct D3DXVECTOR4
+{
+	float x, y, z, w;
+	D3DXVECTOR4() {}
+	D3DXVECTOR4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+};
+
+struct D3DXQUATERNION
+{
+	float x, y, z, w;
+	D3DXQUATERNION() {}
+	D3DXQUATERNION(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+	D3DXQUATERNION operator*(const D3DXQUATERNION& q) const;
+	D3DXQUATERNION operator*(float f) const { return {x*f, y*f, z*f, w*f}; }
+	D3DXQUATERNION& operator*=(float f) { x*=f; y*=f; z*=f; w*=f; return *this; }
+	D3DXQUATERNION operator+(const D3DXQUATERNION& q) const { return {x+q.x, y+q.y, z+q.z, w+q.w}; }
+	D3DXQUATERNION operator-() const { return {-x, -y, -z, -w}; }
+	bool operator==(const D3DXQUATERNION& q) const { return x==q.x && y==q.y && z==q.z && w==q.w; }
+};
+
+struct D3DMATRIX
+{
+	union
+	{
+		struct
+		{
+			float _11, _12, _13, _14;
+			float _21, _22, _23, _24;
+			float _31, _32, _33, _34;
+			float _41, _42, _43, _44;
+		};
+		float m[4][4];
+	};
+};
+
+struct D3DXMATRIX : public D3DMATRIX
+{
+	D3DXMATRIX() {}
+	D3DXMATRIX(const float* f) { std::memcpy(m, f, sizeof(m)); }
+	D3DXMATRIX(float a11, float a12, float a13, float a14,
+			   float a21, float a22, float a23, float a24,
+			   float a31, float a32, float a33, float a34,
+			   float a41, float a42, float a43, float a44)
+	{
+		_11=a11; _12=a12; _13=a13; _14=a14; _21=a21; _22=a22; _23=a23; _24=a24;
+		_31=a31; _32=a32; _33=a33; _34=a34; _41=a41; _42=a42; _43=a43; _44=a44;
+	}
+	float& operator()(UINT r, UINT c) { return m[r][c]; }
+	float operator()(UINT r, UINT c) const { return m[r][c]; }
+	operator float*() { return &_11; }
+	operator const float*() const { return &_11; }
+	D3DXMATRIX operator*(const D3DXMATRIX& b) const
+	{
+		D3DXMATRIX r;
+		for (int i = 0; i < 4; i++)
+			for (int j = 0; j < 4; j++)
+			{
+				float s = 0;
+				for (int k = 0; k < 4; k++) s += m[i][k] * b.m[k][j];
+				r.m[i][j] = s;
+			}
+		return r;
+	}
+	D3DXMATRIX& operator*=(const D3DXMATRIX& b) { *this = *this * b; return *this; }
+	D3DXMATRIX operator*(float f) const { D3DXMATRIX r; for (int i=0;i<16;i++) (&r._11)[i] = (&_11)[i]*f; return r; }
+	D3DXMATRIX operator+(const D3DXMATRIX& b) const { D3DXMATRIX r; for (int i=0;i<16;i++) (&r._11)[i] = (&_11)[i]+(&b._11)[i]; return r; }
+	bool operator==(const D3DXMATRIX& b) const { return std::memcmp(m, b.m, sizeof(m)) == 0; }
+	bool operator!=(const D3DXMATRIX& b) const { return !(*this == b); }
+};
+
+inline D3DXQUATERNION D3DXQUATERNION::operator*(const D3DXQUATERNION& q2) const
+{
+	// D3DX  q1 * q2  q1 ̌ q2 ̉] ( n~gς q2 q1 )
+	const D3DXQUATERNION& a = q2; const D3DXQUATERNION& b = *this;
+	return D3DXQUATERNION(
+		a.w*b.x + a.x*b.w + a.y*b.z - a.z*b.y,
+		a.w*b.y - a.x*b.z + a.y*b.w + a.z*b.x,
+		a.w*b.z + a.x*b.y - a.y*b.x + a.z*b.w,
+		a.w*b.w - a.x*b.x - a.y*b.y - a.z*b.z);
+}
+
+inline D3DXMATRIX* D3DXMatrixIdentity(D3DXMATRIX* o)
+{
+	std::memset(o->m, 0, sizeof(o->m)); o->_11 = o->_22 = o->_33 = o->_44 = 1.0f; return o;
+}
+inline BOOL D3DXMatrixIsIdentity(const D3DXMATRIX* m)
+{
+	D3DXMATRIX i; D3DXMatrixIdentity(&i); return *m == i;
+}
+inline D3DXMATRIX* D3DXMatrixMultiply(D3DXMATRIX* o, const D3DXMATRIX* a, const D3DXMATRIX* b) { *o = *a * *b; return o; }
+inline D3DXMATRIX* D3DXMatrixTranspose(D3DXMATRIX* o, const D3DXMATRIX* a)
+{
+	D3DXMATRIX r; for (int i=0;i<4;i++) for (int j=0;j<4;j++) r.m[i][j] = a->m[j][i]; *o = r; return o;
+}
+inline D3DXMATRIX* D3DXMatrixScaling(D3DXMATRIX* o, float x, float y, float z)
+{
+	D3DXMatrixIdentity(o); o->_11 = x; o->_22 = y; o->_33 = z; return o;
+}
+inline D3DXMATRIX* D3DXMatrixTranslation(D3DXMATRIX* o, float x, float y, float z)
+{
+	D3DXMatrixIdentity(o); o->_41 = x; o->_42 = y; o->_43 = z; return o;
+}
+inline D3DXMATRIX* D3DXMatrixRotationX(D3DXMATRIX* o, float a)
+{
+	D3DXMatrixIdentity(o); float c = cosf(a), s = sinf(a); o->_22 = c; o->_23 = s; o->_32 = -s; o->_33 = c; return o;
+}
+inline D3DXMATRIX* D3DXMatrixRotationY(D3DXMATRIX* o, float a)
+{
+	D3DXMatrixIdentity(o); float c = cosf(a), s = sinf(a); o->_11 = c; o->_13 = -s; o->_31 = s; o->_33 = c; return o;
+}
+inline D3DXMATRIX* D3DXMatrixRotationZ(D3DXMATRIX* o, float a)
+{
+	D3DXMatrixIdentity(o); float c = cosf(a), s = sinf(a); o->_11 = c; o->_12 = s; o->_21 = -s; o->_22 = c; return o;
+}
+inline D3DXMATRIX* D3DXMatrixRotationYawPitchRoll(D3DXMATRIX* o, float yaw, float pitch, float roll)
+{
+	D3DXMATRIX z, x, y; D3DXMatrixRotationZ(&z, roll); D3DXMatrixRotationX(&x, pitch); D3DXMatrixRotationY(&y, yaw);
+	*o = z * x * y; return o;
+}
+inline D3DXMATRIX* D3DXMatrixRotationQuaternion(D3DXMATRIX* o, const D3DXQUATERNION* q)
+{
+	float x=q->x, y=q->y, z=q->z, w=q->w;
+	D3DXMatrixIdentity(o);
+	o->_11 = 1-2*(y*y+z*z); o->_12 = 2*(x*y+z*w);   o->_13 = 2*(x*z-y*w);
+	o->_21 = 2*(x*y-z*w);   o->_22 = 1-2*(x*x+z*z); o->_23 = 2*(y*z+x*w);
+	o->_31 = 2*(x*z+y*w);   o->_32 = 2*(y*z-x*w);   o->_33 = 1-2*(x*x+y*y);
+	return o;
+}
+inline FLOAT D3DXVec3Length(const D3DXVECTOR3* v) { return sqrtf(v->x*v->x + v->y*v->y + v->z*v->z); }
+inline FLOAT D3DXVec3LengthSq(const D3DXVECTOR3* v) { return v->x*v->x + v->y*v->y + v->z*v->z; }
+inline FLOAT D3DXVec3Dot(const D3DXVECTOR3* a, const D3DXVECTOR3* b) { return a->x*b->x + a->y*b->y + a->z*b->z; }
+inline D3DXVECTOR3* D3DXVec3Cross(D3DXVECTOR3* o, const D3DXVECTOR3* a, const D3DXVECTOR3* b)
+{
+	D3DXVECTOR3 r(a->y*b->z - a->z*b->y, a->z*b->x - a->x*b->z, a->x*b->y - a->y*b->x); *o = r; return o;
+}
+inline D3DXVECTOR3* D3DXVec3Normalize(D3DXVECTOR3* o, const D3DXVECTOR3* v)
+{
+	float l = D3DXVec3Length(v); if (l == 0) { *o = D3DXVECTOR3(0,0,0); return o; } *o = *v / l; return o;
+}
+inline D3DXVECTOR3* D3DXVec3TransformCoord(D3DXVECTOR3* o, const D3DXVECTOR3* v, const D3DXMATRIX* m)
+{
+	float x = v->x*m->_11 + v->y*m->_21 + v->z*m->_31 + m->_41;
+	float y = v->x*m->_12 + v->y*m->_22 + v->z*m->_32 + m->_42;
+	float z = v->x*m->_13 + v->y*m->_23 + v->z*m->_33 + m->_43;
+	float w = v->x*m->_14 + v->y*m->_24 + v->z*m->_34 + m->_44;
+	*o = D3DXVECTOR3(x/w, y/w, z/w); return o;
+}
+inline D3DXVECTOR3* D3DXVec3TransformNormal(D3DXVECTOR3* o, const D3DXVECTOR3* v, const D3DXMATRIX* m)
+{
+	float x = v->x*m->_11 + v->y*m->_21 + v->z*m->_31;
+	float y = v->x*m->_12 + v->y*m->_22 + v->z*m->_32;
+	float z = v->x*m->_13 + v->y*m->_23 + v->z*m->_33;
+	*o = D3DXVECTOR3(x, y, z); return o;
+}
+inline D3DXMATRIX* D3DXMatrixInverse(D3DXMATRIX* o, FLOAT* det, const D3DXMATRIX* mm)
+{
+	const float* m = &mm->_11; float inv[16];
+	inv[0] = m[5]*m[10]*m[15]-m[5]*m[11]*m[14]-m[9]*m[6]*m[15]+m[9]*m[7]*m[14]+m[13]*m[6]*m[11]-m[13]*m[7]*m[10];
+	inv[4] = -m[4]*m[10]*m[15]+m[4]*m[11]*m[14]+m[8]*m[6]*m[15]-m[8]*m[7]*m[14]-m[12]*m[6]*m[11]+m[12]*m[7]*m[10];
+	inv[8] = m[4]*m[9]*m[15]-m[4]*m[11]*m[13]-m[8]*m[5]*m[15]+m[8]*m[7]*m[13]+m[12]*m[5]*m[11]-m[12]*m[7]*m[9];
+	inv[12] = -m[4]*m[9]*m[14]+m[4]*m[10]*m[13]+m[8]*m[5]*m[14]-m[8]*m[6]*m[13]-m[12]*m[5]*m[10]+m[12]*m[6]*m[9];
+	inv[1] = -m[1]*m[10]*m[15]+m[1]*m[11]*m[14]+m[9]*m[2]*m[15]-m[9]*m[3]*m[14]-m[13]*m[2]*m[11]+m[13]*m[3]*m[10];
+	inv[5] = m[0]*m[10]*m[15]-m[0]*m[11]*m[14]-m[8]*m[2]*m[15]+m[8]*m[3]*m[14]+m[12]*m[2]*m[11]-m[12]*m[3]*m[10];
+	inv[9] = -m[0]*m[9]*m[15]+m[0]*m[11]*m[13]+m[8]*m[1]*m[15]-m[8]*m[3]*m[13]-m[12]*m[1]*m[11]+m[12]*m[3]*m[9];
+	inv[13] = m[0]*m[9]*m[14]-m[0]*m[10]*m[13]-m[8]*m[1]*m[14]+m[8]*m[2]*m[13]+m[12]*m[1]*m[10]-m[12]*m[2]*m[9];
+	inv[2] = m[1]*m[6]*m[15]-m[1]*m[7]*m[14]-m[5]*m[2]*m[15]+m[5]*m[3]*m[14]+m[13]*m[2]*m[7]-m[13]*m[3]*m[6];
+	inv[6] = -m[0]*m[6]*m[15]+m[0]*m[7]*m[14]+m[4]*m[2]*m[15]-m[4]*m[3]*m[14]-m[12]*m[2]*m[7]+m[12]*m[3]*m[6];
+	inv[10] = m[0]*m[5]*m[15]-m[0]*m[7]*m[13]-m[4]*m[1]*m[15]+m[4]*m[3]*m[13]+m[12]*m[1]*m[7]-m[12]*m[3]*m[5];
+	inv[14] = -m[0]*m[5]*m[14]+m[0]*m[6]*m[13]+m[4]*m[1]*m[14]-m[4]*m[2]*m[13]-m[12]*m[1]*m[6]+m[12]*m[2]*m[5];
+	inv[3] = -m[1]*m[6]*m[11]+m[1]*m[7]*m[10]+m[5]*m[2]*m[11]-m[5]*m[3]*m[10]-m[9]*m[2]*m[7]+m[9]*m[3]*m[6];
+	inv[7] = m[0]*m[6]*m[11]-m[0]*m[7]*m[10]-m[4]*m[2]*m[11]+m[4]*m[3]*m[10]+m[8]*m[2]*m[7]-m[8]*m[3]*m[6];
+	inv[11] = -m[0]*m[5]*m[11]+m[0]*m[7]*m[9]+m[4]*m[1]*m[11]-m[4]*m[3]*m[9]-m[8]*m[1]*m[7]+m[8]*m[3]*m[5];
+	inv[15] = m[0]*m[5]*m[10]-m[0]*m[6]*m[9]-m[4]*m[1]*m[10]+m[4]*m[2]*m[9]+m[8]*m[1]*m[6]-m[8]*m[2]*m[5];
+	float d = m[0]*inv[0] + m[1]*inv[4] + m[2]*inv[8] + m[3]*inv[12];
+	if (det) *det = d;
+	if (d == 0) return nullptr;
+	for (int i = 0; i < 16; i++) inv[i] /= d;
+	std::memcpy(&o->_11, inv, sizeof(inv));
+	return o;
+}
+inline D3DXQUATERNION* D3DXQuaternionRotationAxis(D3DXQUATERNION* o, const D3DXVECTOR3* axis, float angle)
+{
+	D3DXVECTOR3 n; D3DXVec3Normalize(&n, axis); float s = sinf(angle/2);
+	*o = D3DXQUATERNION(n.x*s, n.y*s, n.z*s, cosf(angle/2)); return o;
+}
+inline D3DXQUATERNION* D3DXQuaternionRotationYawPitchRoll(D3DXQUATERNION* o, float yaw, float pitch, float roll)
+{
+	float sy = sinf(yaw/2), cy = cosf(yaw/2), sp = sinf(pitch/2), cp = cosf(pitch/2), sr = sinf(roll/2), cr = cosf(roll/2);
+	o->x = cy*sp*cr + sy*cp*sr;
+	o->y = sy*cp*cr - cy*sp*sr;
+	o->z = cy*cp*sr - sy*sp*cr;
+	o->w = cy*cp*cr + sy*sp*sr;
+	return o;
+}
+inline D3DXQUATERNION* D3DXQuaternionMultiply(D3DXQUATERNION* o, const D3DXQUATERNION* a, const D3DXQUATERNION* b) { *o = *a * *b; return o; }
+inline FLOAT D3DXQuaternionLength(const D3DXQUATERNION* q) { return sqrtf(q->x*q->x+q->y*q->y+q->z*q->z+q->w*q->w); }
+inline FLOAT D3DXQuaternionDot(const D3DXQUATERNION* a, const D3DXQUATERNION* b) { return a->x*b->x+a->y*b->y+a->z*b->z+a->w*b->w; }
+inline D3DXQUATERNION* D3DXQuaternionNormalize(D3DXQUATERNION* o, const D3DXQUATERNION* q)
+{
+	float l = D3DXQuaternionLength(q); *o = *q * (1.0f / l); return o;
+}
+inline D3DXQUATERNION* D3DXQuaternionConjugate(D3DXQUATERNION* o, const D3DXQUATERNION* q) { *o = D3DXQUATERNION(-q->x,-q->y,-q->z,q->w); return o; }
+inline D3DXQUATERNION* D3DXQuaternionIdentity(D3DXQUATERNION* o) { *o = D3DXQUATERNION(0,0,0,1); return o; }
+inline D3DXQUATERNION* D3DXQuaternionRotationMatrix(D3DXQUATERNION* o, const D3DXMATRIX* m)
+{
+	float tr = m->_11 + m->_22 + m->_33;
+	if (tr > 0)
+	{
+		float s = sqrtf(tr + 1.0f) * 2;
+		o->w = 0.25f * s; o->x = (m->_23 - m->_32) / s; o->y = (m->_31 - m->_13) / s; o->z = (m->_12 - m->_21) / s;
+	}
+	else if (m->_11 > m->_22 && m->_11 > m->_33)
+	{
+		float s = sqrtf(1.0f + m->_11 - m->_22 - m->_33) * 2;
+		o->w = (m->_23 - m->_32) / s; o->x = 0.25f * s; o->y = (m->_12 + m->_21) / s; o->z = (m->_13 + m->_31) / s;
+	}
+	else if (m->_22 > m->_33)
+	{
+		float s = sqrtf(1.0f + m->_22 - m->_11 - m->_33) * 2;
+		o->w = (m->_31 - m->_13) / s; o->x = (m->_12 + m->_21) / s; o->y = 0.25f * s; o->z = (m->_23 + m->_32) / s;
+	}
+	else
+	{
+		float s = sqrtf(1.0f + m->_33 - m->_11 - m->_22) * 2;
+		o->w = (m->_12 - m->_21) / s; o->x = (m->_13 + m->_31) / s; o->y = (m->_23 + m->_32) / s; o->z = 0.25f * s;
+	}
+	return o;
+}
+inline HRESULT D3DXMatrixDecompose(D3DXVECTOR3* s, D3DXQUATERNION* q, D3DXVECTOR3* t, const D3DXMATRIX* m)
+{
+	D3DXVECTOR3 r0(m->_11,m->_12,m->_13), r1(m->_21,m->_22,m->_23), r2(m->_31,m->_32,m->_33);
+	D3DXVECTOR3 sc(D3DXVec3Length(&r0), D3DXVec3Length(&r1), D3DXVec3Length(&r2));
+	D3DXMATRIX r; D3DXMatrixIdentity(&r);
+	r._11 = r0.x/sc.x; r._12 = r0.y/sc.x; r._13 = r0.z/sc.x;
+	r._21 = r1.x/sc.y; r._22 = r1.y/sc.y; r._23 = r1.z/sc.y;
+	r._31 = r2.x/sc.z; r._32 = r2.y/sc.z; r._33 = r2.z/sc.z;
+	D3DXQuaternionRotationMatrix(q, &r);
+	D3DXVECTOR3 tr(m->_41, m->_42, m->_43);
+	*s = sc; *t = tr;
+	return D3D_OK;
+}
+inline D3DXQUATERNION* D3DXQuaternionSlerp(D3DXQUATERNION* o, const D3DXQUATERNION* a, const D3DXQUATERNION* b, float t)
+{
+	float d = D3DXQuaternionDot(a, b); D3DXQUATERNION bb = *b; if (d < 0) { d = -d; bb = -bb; }
+	if (d > 0.9995f) { *o = *a * (1-t) + bb * t; return D3DXQuaternionNormalize(o, o); }
+	float th = acosf(d), s = sinf(th);
+	*o = *a * (sinf((1-t)*th)/s) + bb * (sinf(t*th)/s); return o;
+}
\ No newline at end of file
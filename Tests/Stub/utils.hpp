@@ -0,0 +1,11 @@
+#include <cstdio>
+#include <algorithm>
+#pragma once
+
+// eXgp utils.hpp ̑ ( fobOo͕͂WG[ )
+template<class... Args>
+inline void OutputDebugFormat(const char* const format, Args... args)
+{
+	if constexpr (sizeof...(Args) == 0) std::fputs(format, stderr);
+	else                                std::fprintf(stderr, format, args...);
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include <cstdio>
+#include <cmath>
+#include <d3dx9.h>
+#pragma once
+
+//
+// eXg̏ ( so͂ĐAmain ̖߂l ctest ɒm点 )
+//
+
+inline int testFailCount = 0;
+
+#define TEST_CHECK(condition)                                                              \
+	do                                                                                     \
+	{                                                                                      \
+		if (!(condition))                                                                  \
+		{                                                                                  \
+			std::printf("FAIL %s(%d) : %s\n", __FILE__, __LINE__, #condition);           \
+			testFailCount++;                                                               \
+		}                                                                                  \
+	}                                                                                      \
+	while (0)
+
+// 덷͈̔͂œ
+inline bool IsNear(float a, float b, float epsilon = 1e-4f)
+{
+	return std::fabs(a - b) <= epsilon;
+}
+
+inline bool IsNear(const D3DXVECTOR3& a, const D3DXVECTOR3& b, float epsilon = 1e-4f)
+{
+	return IsNear(a.x, b.x, epsilon) && IsNear(a.y, b.y, epsilon) && IsNear(a.z, b.z, epsilon);
+}
+
+inline bool IsNear(const D3DXMATRIX& a, const D3DXMATRIX& b, float epsilon = 1e-4f)
+{
+	for (int i = 0; i < 16; i++)
+	{
+		if (!IsNear((&a._11)[i], (&b._11)[i], epsilon)) return false;
+	}
+	return true;
+}
+
+// ʂo͂ďIR[hԂ
+inline int TestResult(const char* const name)
+{
+	if (testFailCount == 0) std::printf("%s : ok\n", name);
+	else                    std::printf("%s : %d failed\n", name, testFailCount);
+
+	return testFailCount == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,311 @@
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include "TestCommon.hpp"
+#include "Transform.hpp"
+#include "TransformScheduler.hpp"
+
+//
+// Transform : eqƍs̍XV
+//
+
+// [JsXVȂ[hs݂̏́Alx΃[Jsɔf
+static void TestSameWorldWriteUpdatesLocal()
+{
+    Transform parent;
+    Transform child(&parent);
+
+    const D3DXVECTOR3 location(5.0f, 0.0f, 0.0f);
+    child.SetWorldLocation(&location, false);
+    child.SetWorldLocation(&location, true);
+    TEST_CHECK(child.GetLocalMatrix()._41 == 5.0f);
+
+    parent.SetWorldLocation(1.0f, 0.0f, 0.0f);
+    TEST_CHECK(IsNear(child.GetWorldLocation(), D3DXVECTOR3(6.0f, 0.0f, 0.0f)));
+}
+
+// Ԉ̕؂Oꂽq͊Ԉ ( o^͂̂܂ )
+static void TestLeavingThrottledSubtree()
+{
+    Transform root;
+    Transform breakChild(&root), detachChild(&root), reparentChild(&root);
+    Transform grandChild(&reparentChild);
+
+    TransformScheduler scheduler;
+    scheduler.Register(&root, 4);
+    TEST_CHECK(breakChild.IsUpdateThrottled() && grandChild.IsUpdateThrottled());
+
+    // eq
+    breakChild.BreakParents();
+    TEST_CHECK(!breakChild.IsUpdateThrottled());
+    breakChild.SetLocalLocation(3.0f, 0.0f, 0.0f);
+    TEST_CHECK(breakChild.GetWorldLocation().x == 3.0f);
+
+    // [hsێĕtւ ( ܂Ăq̕ύXf )
+    grandChild.SetLocalLocation(0.0f, 2.0f, 0.0f);
+    Transform other;
+    Transform* const moved[] = { &reparentChild };
+    Transform::ReparentMany(moved, &other, true);
+    TEST_CHECK(!reparentChild.IsUpdateThrottled() && !grandChild.IsUpdateThrottled());
+    TEST_CHECK(grandChild.GetWorldLocation().y == 2.0f);
+
+    // qSĊO
+    root.DetachAllChildren(true);
+    TEST_CHECK(!detachChild.IsUpdateThrottled());
+
+    // o^͐eOĂԈ܂
+    Transform parent;
+    root.BecomeParents(&parent);
+    root.BreakParents();
+    TEST_CHECK(root.IsUpdateThrottled());
+
+    // Ԉ̕؂ɓƊԈ
+    breakChild.BecomeParents(&root);
+    TEST_CHECK(breakChild.IsUpdateThrottled());
+}
+
+// Ԉ Transform ́A[hs񂩂擾̂ǂœǂłf̕ύXvZ
+static void TestThrottledGettersRefresh()
+{
+    Transform parent;
+    Transform child(&parent);
+    child.SetUpdateThrottled(true);
+
+    // 擾ƂɁAe𓮂Ăŏɓǂ
+    float x = 0.0f;
+    auto moveParent = [&parent, &x]() { x += 1.0f; parent.SetWorldLocation(x, 0.0f, 0.0f); };
+
+    moveParent();
+    TEST_CHECK(child.GetWorldLocation().x == x);
+
+    moveParent();
+    const unsigned int version = child.GetWorldVersion();
+    TEST_CHECK(child.GetWorldMatrix()._41 == x && child.GetWorldVersion() == version);
+
+    moveParent();
+    TEST_CHECK(IsNear(child.GetInverseWorldMatrix()._41, -x));
+
+    moveParent();
+    child.SetLocalRotation(0.0f, 0.0f, 0.0f);
+    parent.SetWorldRotation(D3DX_PI * 0.5f, 0.0f, 0.0f);
+    TEST_CHECK(IsNear(child.GetForwardVector(), D3DXVECTOR3(1.0f, 0.0f, 0.0f)));
+}
+
+// ts񂪖[hs ( gk 0 ) ł́Ats@p̍sPʍs
+static void TestSingularInverse()
+{
+    D3DXMATRIX identity;
+    D3DXMatrixIdentity(&identity);
+
+    // ψgk 0
+    Transform uniform;
+    uniform.SetLocalLocation(1.0f, 2.0f, 3.0f);
+    uniform.SetLocalScale(0.0f, 0.0f, 0.0f);
+    TEST_CHECK(uniform.GetInverseWorldMatrix() == identity);
+    TEST_CHECK(uniform.GetNormalMatrix() == identity);
+
+    // ̎ 0
+    Transform general;
+    general.SetLocalRotation(0.3f, 0.2f, 0.1f);
+    general.SetLocalScale(1.0f, 0.0f, 2.0f);
+    TEST_CHECK(general.GetInverseWorldMatrix() == identity);
+    TEST_CHECK(general.GetNormalMatrix() == identity);
+
+    // tŝsɖ߂ΌvZ
+    D3DXMATRIX scaling;
+    D3DXMatrixScaling(&scaling, 1.0f, 2.0f, 3.0f);
+    general.SetLocalMatrix(&scaling);
+    D3DXMATRIX product;
+    D3DXMatrixMultiply(&product, &general.GetWorldMatrix(), &general.GetInverseWorldMatrix());
+    TEST_CHECK(IsNear(product, identity));
+}
+
+// ĂяõLbV́AoH̃[Js񂩐eqςΌvZ
+static void TestRelativeMatrixCache()
+{
+    Transform root;
+    Transform a(&root), b(&root), c(&root);
+    Transform from(&a), to(&b);
+
+    from.SetLocalLocation(1.0f, 0.0f, 0.0f);
+    to.SetLocalRotation(0.0f, 0.5f, 0.0f);
+
+    Transform::RelativeMatrixCache cache;
+    const D3DXMATRIX first = Transform::GetRelativeMatrix(&from, &to, &cache);
+    TEST_CHECK(IsNear(first, Transform::GetRelativeMatrix(&from, &to)));
+
+    // ʂ̐c͌ʂɊ֌WȂ
+    root.SetLocalLocation(100.0f, 0.0f, 0.0f);
+    TEST_CHECK(IsNear(Transform::GetRelativeMatrix(&from, &to, &cache), Transform::GetRelativeMatrix(&from, &to)));
+
+    // oH̖f̕ύX
+    a.SetLocalLocation(0.0f, 5.0f, 0.0f, false);
+    const D3DXMATRIX moved = Transform::GetRelativeMatrix(&from, &to, &cache);
+    TEST_CHECK(IsNear(moved, Transform::GetRelativeMatrix(&from, &to)));
+    TEST_CHECK(!IsNear(moved, first));
+
+    // e̕tւ ( [Js̔ł̘a͓ )
+    b.SetLocalLocation(0.0f, 0.0f, 3.0f);
+    c.SetLocalLocation(0.0f, 0.0f, 7.0f);
+    Transform::GetRelativeMatrix(&from, &to, &cache);
+
+    Transform* const moving[] = { &to };
+    Transform::ReparentMany(moving, &c, false);
+    TEST_CHECK(IsNear(Transform::GetRelativeMatrix(&from, &to, &cache), Transform::GetRelativeMatrix(&from, &to)));
+
+    // ʂ̑g
+    TEST_CHECK(IsNear(Transform::GetRelativeMatrix(&to, &from, &cache), Transform::GetRelativeMatrix(&to, &from)));
+}
+
+// eq̉͌Z̏Ԃۂ ( j͍Ō̎q󂢂ʒuɈڂ )
+static void TestRemoveChildKeepsOrder()
+{
+    Transform parent, other;
+    Transform c0(&parent), c1(&parent), c2(&parent), c3(&parent), c4(&parent), c5(&parent);
+
+    auto isChildren = [](const Transform& transform, std::initializer_list<const Transform*> expected)
+    {
+        const auto children = transform.GetChildren();
+        return std::equal(children.begin(), children.end(), expected.begin(), expected.end());
+    };
+
+    TEST_CHECK(parent.RemoveChild(&c1));
+    TEST_CHECK(isChildren(parent, { &c0, &c2, &c3, &c4, &c5 }));
+
+    c3.BreakParents();
+    TEST_CHECK(isChildren(parent, { &c0, &c2, &c4, &c5 }));
+
+    Transform* const moved[] = { &c4, &c0 };
+    Transform::ReparentMany(moved, &other);
+    TEST_CHECK(isChildren(parent, { &c2, &c5 }));
+    TEST_CHECK(isChildren(other,  { &c4, &c0 }));
+
+    // oĂʒul߂
+    TEST_CHECK(parent.RemoveChild(&c5) && isChildren(parent, { &c2 }));
+    TEST_CHECK(other.RemoveChild(&c0)  && isChildren(other,  { &c4 }));
+
+    // j
+    Transform* const d0 = new Transform(&parent);
+    Transform* const d1 = new Transform(&parent);
+    delete d0;
+    TEST_CHECK(parent.GetChildren().size() == 2 && parent.RemoveChild(d1) && isChildren(parent, { &c2 }));
+    delete d1;
+}
+
+// ʂ̃Xbhŕʂ̖؂XVĂAŜ̕ύX񐔂͎肱ڂȂ
+static void TestWorldChangeCountAcrossThreads()
+{
+    constexpr int nodeCount = 64;
+    constexpr int frames    = 2000;
+
+    std::vector<std::unique_ptr<Transform>> trees[2];
+    for (auto& tree : trees)
+    {
+        tree.push_back(std::make_unique<Transform>());
+        for (int i = 1; i < nodeCount; i++) tree.push_back(std::make_unique<Transform>(tree.back().get()));
+    }
+
+    const unsigned int before = Transform::GetWorldChangeCount();
+
+    auto move = [](Transform* const root)
+    {
+        for (int frame = 1; frame <= frames; frame++) root->SetLocalLocation(static_cast<float>(frame), 0.0f, 0.0f);
+    };
+    std::thread worker(move, trees[0].front().get());
+    move(trees[1].front().get());
+    worker.join();
+
+    TEST_CHECK(Transform::GetWorldChangeCount() - before == 2u * nodeCount * frames);
+}
+
+// XVCxg𐔂
+class CountingTransform : public Transform
+{
+public:
+    using Transform::Transform;
+
+    int updateCount = 0;
+
+protected:
+    void EventTransformUpdated() override { this->updateCount++; }
+};
+
+// gݗĂm[h̉̊Õm[heɎm[h́AVëʒuxvZACxgx
+static void TestBuildHierarchyUnderOutsideParent()
+{
+    CountingTransform root;
+    CountingTransform outside(&root);
+    CountingTransform node(&outside), child, grandChild(&child);
+    CountingTransform direct(&root);
+
+    outside.SetLocalLocation(0.0f, 1.0f, 0.0f);
+
+    // direct ͑gݗĂm[h̒ ( O̐eł͂Ȃ̂ŁAKwɌvZ )
+    Transform* const transforms[] = { &root, &node, &child, &direct };
+    const int parentIndices[]     = { -1, -1, 1, -1 };
+
+    D3DXMATRIX localMatrices[4];
+    D3DXMatrixTranslation(&localMatrices[0], 10.0f, 0.0f, 0.0f);
+    D3DXMatrixTranslation(&localMatrices[1], 0.0f, 0.0f, 2.0f);
+    D3DXMatrixTranslation(&localMatrices[2], 0.0f, 0.0f, 3.0f);
+    D3DXMatrixTranslation(&localMatrices[3], 0.0f, 4.0f, 0.0f);
+
+    root.updateCount = outside.updateCount = node.updateCount = child.updateCount = grandChild.updateCount = direct.updateCount = 0;
+    TEST_CHECK(Transform::BuildHierarchy(transforms, parentIndices, localMatrices));
+
+    TEST_CHECK(IsNear(node.GetWorldLocation(),       D3DXVECTOR3(10.0f, 1.0f, 2.0f)));
+    TEST_CHECK(IsNear(child.GetWorldLocation(),      D3DXVECTOR3(10.0f, 1.0f, 5.0f)));
+    TEST_CHECK(IsNear(grandChild.GetWorldLocation(), D3DXVECTOR3(10.0f, 1.0f, 5.0f)));
+    TEST_CHECK(IsNear(direct.GetWorldLocation(),     D3DXVECTOR3(10.0f, 4.0f, 0.0f)));
+
+    TEST_CHECK(root.updateCount == 1 && outside.updateCount == 1);
+    TEST_CHECK(node.updateCount == 1 && child.updateCount == 1 && grandChild.updateCount == 1 && direct.updateCount == 1);
+}
+
+// NH[^jI[h̃[h̉]́Ae]Aψgk (  ) ĂĂ[hsɂ̂܂܊|
+static void TestQuaternionWorldRotationUnderParent()
+{
+    for (const float parentScale : { 1.0f, 2.0f, -0.5f })
+    {
+        Transform parent;
+        parent.SetLocalRotation(0.4f, -0.3f, 0.2f);
+        D3DXMATRIX parentMatrix = parent.GetLocalMatrix();
+        for (int row = 0; row < 3; row++)
+        {
+            for (int column = 0; column < 3; column++) parentMatrix.m[row][column] *= parentScale;
+        }
+        parent.SetLocalMatrix(&parentMatrix);
+
+        Transform child(&parent);
+        child.SetLocalRotation(0.1f, 0.2f, 0.3f);
+        child.SetQuaternionRotationMode(true);
+
+        D3DXMATRIX delta, expected;
+        D3DXMatrixRotationYawPitchRoll(&delta, 0.5f, 0.25f, -0.1f);
+        D3DXMatrixMultiply(&expected, &child.GetWorldMatrix(), &delta);
+
+        child.AddWorldRotation(0.5f, 0.25f, -0.1f);
+
+        const D3DXMATRIX& world = child.GetWorldMatrix();
+        for (int row = 0; row < 3; row++)
+        {
+            for (int column = 0; column < 3; column++) TEST_CHECK(IsNear(world.m[row][column], expected.m[row][column], 1e-4f));
+        }
+    }
+}
+
+int main()
+{
+    TestSameWorldWriteUpdatesLocal();
+    TestLeavingThrottledSubtree();
+    TestThrottledGettersRefresh();
+    TestSingularInverse();
+    TestRelativeMatrixCache();
+    TestRemoveChildKeepsOrder();
+    TestWorldChangeCountAcrossThreads();
+    TestBuildHierarchyUnderOutsideParent();
+    TestQuaternionWorldRotationUnderParent();
+
+    return TestResult("TransformTest");
+}
\ No newline at end of file
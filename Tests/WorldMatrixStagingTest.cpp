@@ -0,0 +1,99 @@
+#include <vector>
+#include <cstring>
+#include "TestCommon.hpp"
+#include "WorldMatrixStaging.hpp"
+
+//
+// WorldMatrixStaging : ooCg CPU Ŋm߂
+//
+
+// ς ( Xbgԍ, 0 , [hs ) ŋl߂ďo
+static void TestWriteChanged()
+{
+    Transform a, b, c;
+    WorldMatrixStaging staging;
+    const unsigned int slotA = staging.Register(&a);
+    const unsigned int slotB = staging.Register(&b);
+    const unsigned int slotC = staging.Register(&c);
+
+    // o^͑SĕύX
+    TEST_CHECK(staging.Collect() == 3);
+    TEST_CHECK(staging.Collect() == 0);
+
+    b.SetLocalLocation(1.0f, 2.0f, 3.0f);
+    c.SetLocalLocation(4.0f, 5.0f, 6.0f);
+    TEST_CHECK(staging.Collect() == 2);
+
+    std::vector<WorldMatrixStaging::Entry> entries(4);
+    std::memset(entries.data(), 0xCD, entries.size() * sizeof(WorldMatrixStaging::Entry));
+
+    TEST_CHECK(staging.WriteChanged(entries.data(), entries.size() * sizeof(WorldMatrixStaging::Entry)) == 2);
+    TEST_CHECK(entries[0].index == slotB && entries[1].index == slotC);
+    TEST_CHECK(entries[0].reserved[0] == 0 && entries[0].reserved[1] == 0 && entries[0].reserved[2] == 0);
+    TEST_CHECK(std::memcmp(&entries[0].matrix, &b.GetWorldMatrix(), sizeof(D3DXMATRIX)) == 0);
+    TEST_CHECK(std::memcmp(&entries[1].matrix, &c.GetWorldMatrix(), sizeof(D3DXMATRIX)) == 0);
+
+    // 肫ȂΑ
+    TEST_CHECK(staging.WriteChanged(entries.data(), sizeof(WorldMatrixStaging::Entry)) == 1);
+    TEST_CHECK(staging.WriteChanged(entries.data(), sizeof(WorldMatrixStaging::Entry), 1) == 1);
+    TEST_CHECK(entries[0].index == slotC);
+
+    (void)slotA;
+}
+
+// Xbgԍ̈ʒuɏA߂͈͂͂Ȃ
+static void TestWriteDirtyRanges()
+{
+    std::vector<Transform> transforms(8);
+    WorldMatrixStaging staging;
+    for (Transform& transform : transforms) staging.Register(&transform);
+    staging.Collect();
+
+    transforms[1].SetLocalLocation(1.0f, 0.0f, 0.0f);
+    transforms[2].SetLocalLocation(2.0f, 0.0f, 0.0f);
+    transforms[5].SetLocalLocation(5.0f, 0.0f, 0.0f);
+    staging.Collect();
+
+    std::vector<D3DXMATRIX> matrices(transforms.size());
+    std::vector<WorldMatrixStaging::Range> ranges;
+
+    TEST_CHECK(staging.WriteDirtyRanges(matrices.data(), matrices.size(), &ranges) == 2);
+    TEST_CHECK(ranges[0].first == 1 && ranges[0].count == 2);
+    TEST_CHECK(ranges[1].first == 5 && ranges[1].count == 1);
+    TEST_CHECK(matrices[5]._41 == 5.0f);
+
+    TEST_CHECK(staging.WriteDirtyRanges(matrices.data(), matrices.size(), &ranges, 2) == 1);
+    TEST_CHECK(ranges[0].first == 1 && ranges[0].count == 5);
+}
+
+// Collect() ̌ɉꂽXbg͏oȂ
+static void TestUnregisterAfterCollect()
+{
+    Transform* const a = new Transform();
+    Transform        b;
+    WorldMatrixStaging staging;
+    const unsigned int slotA = staging.Register(a);
+    const unsigned int slotB = staging.Register(&b);
+    TEST_CHECK(staging.Collect() == 2);
+
+    staging.Unregister(slotA);
+    delete a;
+
+    WorldMatrixStaging::Entry entries[2];
+    TEST_CHECK(staging.WriteChanged(entries, sizeof(entries)) == 1);
+    TEST_CHECK(entries[0].index == slotB);
+
+    std::vector<D3DXMATRIX> matrices(staging.GetSlotCount());
+    std::vector<WorldMatrixStaging::Range> ranges;
+    TEST_CHECK(staging.WriteDirtyRanges(matrices.data(), matrices.size(), &ranges) == 1);
+    TEST_CHECK(ranges[0].first == slotB);
+}
+
+int main()
+{
+    TestWriteChanged();
+    TestWriteDirtyRanges();
+    TestUnregisterAfterCollect();
+
+    return TestResult("WorldMatrixStagingTest");
+}
\ No newline at end of file
@@ -0,0 +1,247 @@
+#include "AimConstraintSolver.hpp"
+#include "TransformTrace.hpp"
+#include <unordered_map>
+
+AimConstraintSolver::AimConstraintSolver()
+{
+}
+
+AimConstraintSolver::~AimConstraintSolver()
+{
+}
+
+/****************************************  ****************************************/
+
+bool AimConstraintSolver::AddConstraint(Transform* const owner, Transform* const target, const D3DXVECTOR3& worldUp)
+{
+    if (!target)
+    {
+        OutputDebugFormat("AimConstraintSolver.AddConstraint : target is nullptr.\n");
+        return false;
+    }
+
+    return this->Add({ owner, target, D3DXVECTOR3(0.0f, 0.0f, 0.0f), worldUp });
+}
+
+bool AimConstraintSolver::AddConstraint(Transform* const owner, const D3DXVECTOR3& targetLocation, const D3DXVECTOR3& worldUp)
+{
+    return this->Add({ owner, nullptr, targetLocation, worldUp });
+}
+
+bool AimConstraintSolver::RemoveConstraint(Transform* const owner)
+{
+    for (auto it = this->constraints.begin(); it != this->constraints.end(); ++it)
+    {
+        if (it->owner != owner) continue;
+
+        this->constraints.erase(it);
+        return true;
+    }
+
+    return false;
+}
+
+void AimConstraintSolver::Clear()
+{
+    this->constraints.clear();
+}
+
+size_t AimConstraintSolver::GetConstraintCount() const
+{
+    return this->constraints.size();
+}
+
+
+
+/****************************************  ****************************************/
+
+size_t AimConstraintSolver::Solve()
+{
+    TRANSFORM_TRACE_SCOPE("AimConstraintSolver.Solve");
+
+    if (this->constraints.empty()) return 0;
+
+    this->BuildOrder();
+
+    // `d镔؂̍́AO ( f̈󂪏O ) ɋ߂
+    this->owners.clear();
+    for (const Constraint& constraint : this->constraints) this->owners.push_back(constraint.owner);
+
+    Transform::CollectUpdateRoots(this->owners, &this->roots);
+
+    // ˑɉ ( [J]邾 )
+    size_t solved = 0;
+    for (const size_t index : this->order)
+    {
+        if (AimConstraintSolver::SolveOne(this->constraints[index])) solved++;
+    }
+
+    // ؂ƂɈx`d
+    for (Transform* const root : this->roots)
+    {
+        root->PropagateWorldMatrix();
+    }
+
+    return solved;
+}
+
+
+
+/****************************************  ****************************************/
+
+bool AimConstraintSolver::Add(const Constraint& constraint)
+{
+    if (!constraint.owner)
+    {
+        OutputDebugFormat("AimConstraintSolver.AddConstraint : owner is nullptr.\n");
+        return false;
+    }
+
+    if (constraint.owner == constraint.target)
+    {
+        OutputDebugFormat("AimConstraintSolver.AddConstraint : owner can not aim at itself.\n");
+        return false;
+    }
+
+    // Ȃ㏑
+    for (Constraint& existing : this->constraints)
+    {
+        if (existing.owner != constraint.owner) continue;
+
+        existing = constraint;
+        return true;
+    }
+
+    this->constraints.push_back(constraint);
+    return true;
+}
+
+void AimConstraintSolver::BuildOrder()
+{
+    const size_t count = this->constraints.size();
+
+    //  -> 
+    std::unordered_map<Transform*, size_t> ownerIndices;
+    ownerIndices.reserve(count);
+    for (size_t i = 0; i < count; i++) ownerIndices.emplace(this->constraints[i].owner, i);
+
+    // ˑ ( ̐cAڕWƂ̐c𓮂񂪐 )
+    std::vector<std::vector<size_t>> dependents(count);
+    std::vector<size_t>              inDegrees(count, 0);
+
+    auto addEdges = [&](Transform* node, size_t index)
+    {
+        for (; node; node = node->GetParent())
+        {
+            auto found = ownerIndices.find(node);
+            if (found == ownerIndices.end() || found->second == index) continue;
+
+            dependents[found->second].push_back(index);
+            inDegrees[index]++;
+        }
+    };
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const Constraint& constraint = this->constraints[i];
+
+        addEdges(constraint.owner->GetParent(), i);
+        addEdges(constraint.target, i);
+    }
+
+    // g|WJ\[g ( i͓o^ )
+    this->order.clear();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (inDegrees[i] == 0) this->order.push_back(i);
+    }
+
+    for (size_t head = 0; head < this->order.size(); head++)
+    {
+        for (const size_t next : dependents[this->order[head]])
+        {
+            if (--inDegrees[next] == 0) this->order.push_back(next);
+        }
+    }
+
+    // zĂ镪͓o^
+    if (this->order.size() != count)
+    {
+        OutputDebugFormat("AimConstraintSolver.Solve : cyclic constraints are solved in registration order.\n");
+
+        for (size_t i = 0; i < count; i++)
+        {
+            if (inDegrees[i] != 0) this->order.push_back(i);
+        }
+    }
+}
+
+bool AimConstraintSolver::SolveOne(const Constraint& constraint)
+{
+    Transform* const owner  = constraint.owner;
+    Transform* const parent = owner->GetParent();
+
+    // ɉ̕ύX܂߂AƖڕW̍W
+    const D3DXMATRIX& ownerWorld = owner->ComputeWorldMatrixNow();
+    const D3DXVECTOR3 ownerLocation(ownerWorld._41, ownerWorld._42, ownerWorld._43);
+
+    D3DXVECTOR3 targetLocation = constraint.targetLocation;
+    if (constraint.target)
+    {
+        const D3DXMATRIX& targetWorld = constraint.target->ComputeWorldMatrixNow();
+        targetLocation = D3DXVECTOR3(targetWorld._41, targetWorld._42, targetWorld._43);
+    }
+
+    // O
+    D3DXVECTOR3 forward = targetLocation - ownerLocation;
+    const float lengthSq = D3DXVec3LengthSq(&forward);
+    if (lengthSq <= 1e-12f) return false;
+    forward /= sqrtf(lengthSq);
+
+    // E ( ƑOsȂAOƈԒɋ߂g )
+    D3DXVECTOR3 right;
+    D3DXVec3Cross(&right, &constraint.worldUp, &forward);
+    if (D3DXVec3LengthSq(&right) <= 1e-12f)
+    {
+        const float ax = fabsf(forward.x), ay = fabsf(forward.y), az = fabsf(forward.z);
+        const D3DXVECTOR3 axis = (ax <= ay && ax <= az) ? D3DXVECTOR3(1.0f, 0.0f, 0.0f)
+                               : (ay <= az)             ? D3DXVECTOR3(0.0f, 1.0f, 0.0f)
+                               :                          D3DXVECTOR3(0.0f, 0.0f, 1.0f);
+        D3DXVec3Cross(&right, &axis, &forward);
+    }
+    D3DXVec3Normalize(&right, &right);
+
+    // 
+    D3DXVECTOR3 up;
+    D3DXVec3Cross(&up, &forward, &right);
+
+    // [h] ( s right, up, forward )
+    D3DXMATRIX rotation;
+    D3DXMatrixIdentity(&rotation);
+    rotation._11 = right.x;   rotation._12 = right.y;   rotation._13 = right.z;
+    rotation._21 = up.x;      rotation._22 = up.y;      rotation._23 = up.z;
+    rotation._31 = forward.x; rotation._32 = forward.y; rotation._33 = forward.z;
+
+    // [J] = [h] * ẻ]̓]u ( e̊̓LbVg )
+    if (parent)
+    {
+        const Transform::Basis& basis = parent->GetBasis();
+
+        D3DXMATRIX parentTranspose;
+        D3DXMatrixIdentity(&parentTranspose);
+        parentTranspose._11 = basis.right.x; parentTranspose._12 = basis.up.x; parentTranspose._13 = basis.forward.x;
+        parentTranspose._21 = basis.right.y; parentTranspose._22 = basis.up.y; parentTranspose._23 = basis.forward.y;
+        parentTranspose._31 = basis.right.z; parentTranspose._32 = basis.up.z; parentTranspose._33 = basis.forward.z;
+
+        rotation *= parentTranspose;
+    }
+
+    D3DXQUATERNION quat;
+    D3DXQuaternionRotationMatrix(&quat, &rotation);
+    D3DXQuaternionNormalize(&quat, &quat);
+
+    // `d͂Ȃ ( f̈󂪕tAňx`d )
+    owner->SetLocalQuaternion(&quat, false);
+
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include <vector>
+#include <d3dx9.h>
+#include "Transform.hpp"
+#pragma once
+
+/// <summary>
+///  ( look-at / aim ) ܂Ƃ߂ĉ
+/// ͈xo^΁ASolve() ňˑ ( cڕW𓮂񂪐 ) ɉA
+/// ̃[J]`dɏĂAύXꂽ؂ƂɈx`d
+/// 
+/// ̑O ( z ) ڕWɁA ( y )  worldUp Ɍ ( [J̍WƃXP[͈ێ )
+/// o^ Transform jO RemoveConstraint() 邱
+/// </summary>
+class AimConstraintSolver
+{
+public:
+	/***** ctor, dtor *****/
+	AimConstraintSolver();
+	~AimConstraintSolver();
+
+public:
+	/*****  *****/
+
+	/// <summary>
+	/// owner  target ̕ǉ (  owner ̐͏㏑ )
+	/// </summary>
+	/// <param name="owner">	] Transform </param>
+	/// <param name="target">	 Transform </param>
+	/// <param name="worldUp">	 ( [h ) </param>
+	/// <returns> ǉł </returns>
+	bool AddConstraint(Transform* const owner, Transform* const target, const D3DXVECTOR3& worldUp = D3DXVECTOR3(0.0f, 1.0f, 0.0f));
+
+	/// <summary>
+	/// owner Œ̍W̕ǉ (  owner ̐͏㏑ )
+	/// </summary>
+	/// <param name="owner">			] Transform </param>
+	/// <param name="targetLocation">	̍W ( [h ) </param>
+	/// <param name="worldUp">			 ( [h ) </param>
+	/// <returns> ǉł </returns>
+	bool AddConstraint(Transform* const owner, const D3DXVECTOR3& targetLocation, const D3DXVECTOR3& worldUp = D3DXVECTOR3(0.0f, 1.0f, 0.0f));
+
+	// O
+	bool RemoveConstraint(Transform* const owner);
+
+	// SĂ̐O
+	void Clear();
+
+	// ̐
+	size_t GetConstraintCount() const;
+
+public:
+	/*****  *****/
+
+	/// <summary>
+	/// SĂ̐ˑɉA[hsx`d
+	/// zĂ鐧͓o^ɉ
+	/// </summary>
+	/// <returns> ̐ ( ƖڕWʒû̂͏ ) </returns>
+	size_t Solve();
+
+private:
+	//  1 
+	struct Constraint
+	{
+		Transform*  owner;
+		Transform*  target;			// nullptr Ȃ targetLocation
+		D3DXVECTOR3 targetLocation;
+		D3DXVECTOR3 worldUp;
+	};
+
+private:
+	// ǉA㏑
+	bool Add(const Constraint& constraint);
+
+	// ˑ߂ ( KwςĂĂǂ悤 Solve() Ƃ )
+	void BuildOrder();
+
+	//  1  ( `d͂Ȃ )
+	static bool SolveOne(const Constraint& constraint);
+
+private:
+	//  ( o^ )
+	std::vector<Constraint> constraints;
+
+	//  ( constraints ̓Y )
+	std::vector<size_t> order;
+
+	// Solve() Ŏg
+	std::vector<Transform*> owners;
+	std::vector<Transform*> roots;
+};
\ No newline at end of file
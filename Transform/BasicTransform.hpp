@@ -0,0 +1,721 @@
+#include <vector>
+#include <algorithm>
+#include <d3dx9.h>
+#include "Transform.hpp"
+#pragma once
+
+/***** policy *****/
+
+// BasicTransform ̋@\RpCɎw肷|V[
+//   bRotation     : ]
+//   bScale        : gk
+//   bUniformScale : gkψ ( x = y = z ) Ɍ肷邩
+//   bEvent        : sXV EventTransformUpdated(transform) ĂԂ
+//
+// Cxg󂯎肽ꍇ FullTransformPolicy p
+// static void EventTransformUpdated(BasicTransform<g>* transform) `
+
+// S@\ ( Transform ƓAz֐Ȃ )
+struct FullTransformPolicy
+{
+	static constexpr bool bRotation     = true;
+	static constexpr bool bScale        = true;
+	static constexpr bool bUniformScale = false;
+	static constexpr bool bEvent        = true;
+
+	template<class T> static void EventTransformUpdated(T* const) {}
+};
+
+// ψgk + ] + sړ
+struct UniformScaleTransformPolicy
+{
+	static constexpr bool bRotation     = true;
+	static constexpr bool bScale        = true;
+	static constexpr bool bUniformScale = true;
+	static constexpr bool bEvent        = false;
+};
+
+// ] + sړ (  )
+struct RigidTransformPolicy
+{
+	static constexpr bool bRotation     = true;
+	static constexpr bool bScale        = false;
+	static constexpr bool bUniformScale = false;
+	static constexpr bool bEvent        = false;
+};
+
+// sړ̂
+struct TranslationTransformPolicy
+{
+	static constexpr bool bRotation     = false;
+	static constexpr bool bScale        = false;
+	static constexpr bool bUniformScale = false;
+	static constexpr bool bEvent        = false;
+};
+
+/// <summary>
+/// @\|V[ōi Transform
+/// gȂ@\ ( gk sqrtAXP[s̊|ZA̍ĐK  ) RpCɎ菜
+/// eq͓|V[mł̂ݑg߂
+/// </summary>
+template<class Policy>
+class BasicTransform
+{
+public:
+	/***** ctor, dtor *****/
+
+	BasicTransform() : BasicTransform(nullptr, nullptr) // Ϗ
+	{
+	}
+
+	BasicTransform(BasicTransform* const parent) : BasicTransform(parent, nullptr) // Ϗ
+	{
+	}
+
+	BasicTransform
+	(
+		BasicTransform*   const parent,
+		const D3DXMATRIX* const localMatrix
+	)
+	{
+		this->parentTransform = nullptr;
+
+		if (localMatrix) this->localMatrix = *localMatrix;
+		else             D3DXMatrixIdentity(&this->localMatrix);
+
+		// eqɂȂĂ烏[hsxvZ
+		if (parent) parent->AddChild(this);
+
+		this->UpdateWorldMatrix();
+	}
+
+	// eOAq̓[hsێ܂ܐeɂ ( Transform Ɠ )
+	~BasicTransform()
+	{
+		for (BasicTransform* const child : this->childrenTransforms)
+		{
+			child->parentTransform = nullptr;
+			child->localMatrix     = child->worldMatrix;
+		}
+
+		if (this->parentTransform) this->parentTransform->RemoveChild(this);
+	}
+
+
+public:
+	/***** eq֘A *****/
+
+	// e擾
+	BasicTransform* GetParent() const
+	{
+		return this->parentTransform;
+	}
+
+	// q擾
+	const std::vector<BasicTransform*>& GetChildren() const
+	{
+		return this->childrenTransforms;
+	}
+
+	// eqɂȂ ( parent = nullptr Őeq )
+	void BecomeParents(BasicTransform* const parent)
+	{
+		if (parent)
+		{
+			if (parent->AddChild(this))
+			{
+				// e̕ύXɂsXV
+				this->UpdateLocalMatrix();
+			}
+		}
+		else
+		{
+			this->BreakParents();
+		}
+	}
+
+	// eq
+	void BreakParents()
+	{
+		if (!this->parentTransform) return;
+
+		// ̐e
+		this->parentTransform->RemoveChild(this);
+
+		this->parentTransform = nullptr;
+
+		// [hs͂̂܂
+		this->localMatrix = this->worldMatrix;
+	}
+
+	// qǉ
+	bool AddChild(BasicTransform* const child)
+	{
+		if (!child) return false;
+
+		// ̐cɎq
+		if (this->CheckAncestor(child)) return false;
+
+		// O̐e
+		child->BreakParents();
+
+		// eqɂȂ
+		child->parentTransform = this;
+		this->childrenTransforms.push_back(child);
+
+		return true;
+	}
+
+	// q
+	bool RemoveChild(BasicTransform* const child)
+	{
+		if (child && this->HasChild())
+		{
+			this->childrenTransforms.erase
+			(
+				std::remove
+				(
+					this->childrenTransforms.begin(),
+					this->childrenTransforms.end(),
+					child
+				),
+				this->childrenTransforms.end()
+			);
+
+			return true;
+		}
+
+		return false;
+	}
+
+	// c ancestor ݂邩
+	bool CheckAncestor(BasicTransform* const ancestor) const
+	{
+		for (const BasicTransform* check = this; check; check = check->parentTransform)
+		{
+			if (check == ancestor) return true;
+		}
+
+		return false;
+	}
+
+	// eĂ邩
+	bool HasParent() const
+	{
+		return (this->parentTransform != nullptr);
+	}
+
+	// qĂ邩
+	bool HasChild() const
+	{
+		return (this->childrenTransforms.size() != 0);
+	}
+
+
+public:
+	/***** matrix *****/
+
+	// [hs擾
+	const D3DXMATRIX& GetWorldMatrix() const
+	{
+		return this->worldMatrix;
+	}
+
+	// [hsZbgA[JsXV ( |V[O̐͌Ăяo̐ӔC )
+	void SetWorldMatrix(const D3DXMATRIX* const worldMatrix)
+	{
+		if (worldMatrix) this->worldMatrix = *worldMatrix;
+		else D3DXMatrixIdentity(&this->worldMatrix);
+
+		this->UpdateLocalMatrix();
+	}
+
+	// [Js擾
+	const D3DXMATRIX& GetLocalMatrix() const
+	{
+		return this->localMatrix;
+	}
+
+	// [JsZbgA[hsXV ( |V[O̐͌Ăяo̐ӔC )
+	void SetLocalMatrix(const D3DXMATRIX* const localMatrix)
+	{
+		if (localMatrix) this->localMatrix = *localMatrix;
+		else D3DXMatrixIdentity(&this->localMatrix);
+
+		this->UpdateWorldMatrix();
+	}
+
+
+public:
+	/***** location *****/
+
+	/// [hW擾
+	D3DXVECTOR3 GetWorldLocation() const
+	{
+		return D3DXVECTOR3(this->worldMatrix._41, this->worldMatrix._42, this->worldMatrix._43);
+	}
+
+	/// [hWZbg
+	void SetWorldLocation(float x, float y, float z, bool bLocalUpdate = true)
+	{
+		this->worldMatrix._41 = x;
+		this->worldMatrix._42 = y;
+		this->worldMatrix._43 = z;
+
+		if (bLocalUpdate) this->UpdateLocalMatrix();
+	}
+
+	/// [hWɉZ
+	void AddWorldLocation(float x, float y, float z, bool bLocalUpdate = true)
+	{
+		this->worldMatrix._41 += x;
+		this->worldMatrix._42 += y;
+		this->worldMatrix._43 += z;
+
+		if (bLocalUpdate) this->UpdateLocalMatrix();
+	}
+
+	/// [JW擾
+	D3DXVECTOR3 GetLocalLocation() const
+	{
+		return D3DXVECTOR3(this->localMatrix._41, this->localMatrix._42, this->localMatrix._43);
+	}
+
+	/// [JWZbg
+	void SetLocalLocation(float x, float y, float z, bool bWorldUpdate = true)
+	{
+		this->localMatrix._41 = x;
+		this->localMatrix._42 = y;
+		this->localMatrix._43 = z;
+
+		if (bWorldUpdate) this->UpdateWorldMatrix();
+	}
+
+	/// [JWɉZ
+	void AddLocalLocation(float x, float y, float z, bool bWorldUpdate = true)
+	{
+		this->localMatrix._41 += x;
+		this->localMatrix._42 += y;
+		this->localMatrix._43 += z;
+
+		if (bWorldUpdate) this->UpdateWorldMatrix();
+	}
+
+
+public:
+	/***** rotation ( bRotation ̂ ) *****/
+
+	/// <summary>
+	/// [Js̉]Zbg
+	/// </summary>
+	/// <param name="(yaw, pitch, roll)">	Zbg] </param>
+	/// <param name="bWorldUpdate">			[hsXV邩 (ftHg true) </param>
+	void SetLocalRotation(float yaw, float pitch, float roll, bool bWorldUpdate = true) requires Policy::bRotation
+	{
+		D3DXMATRIX rotationMatrix;
+		D3DXMatrixRotationYawPitchRoll(&rotationMatrix, yaw, pitch, roll);
+
+		this->SetLocalBasis(&rotationMatrix, this->GetLocalScale());
+
+		if (bWorldUpdate) this->UpdateWorldMatrix();
+	}
+
+	/// <summary>
+	/// [Js̉]NH[^jIŃZbg
+	/// </summary>
+	/// <param name="quat">			ZbgNH[^jI </param>
+	/// <param name="bWorldUpdate">	[hsXV邩 (ftHg true) </param>
+	void SetLocalQuaternion(const D3DXQUATERNION* quat, bool bWorldUpdate = true) requires Policy::bRotation
+	{
+		D3DXMATRIX rotationMatrix;
+		D3DXMatrixRotationQuaternion(&rotationMatrix, quat);
+
+		this->SetLocalBasis(&rotationMatrix, this->GetLocalScale());
+
+		if (bWorldUpdate) this->UpdateWorldMatrix();
+	}
+
+	/// <summary>
+	/// [Js̉]ɉZ
+	/// </summary>
+	/// <param name="(yaw, pitch, roll)">	Z] </param>
+	/// <param name="bWorldUpdate">			[hsXV邩 (ftHg true) </param>
+	void AddLocalRotation(float yaw, float pitch, float roll, bool bWorldUpdate = true) requires Policy::bRotation
+	{
+		D3DXMATRIX rotationMatrix, result;
+		D3DXMatrixRotationYawPitchRoll(&rotationMatrix, yaw, pitch, roll);
+
+		// ]m̐ςȂ̂ 3x3 ̂
+		BasicTransform::MultiplyAffine(&result, this->localMatrix, rotationMatrix);
+		result._41 = this->localMatrix._41;
+		result._42 = this->localMatrix._42;
+		result._43 = this->localMatrix._43;
+		this->localMatrix = result;
+
+		if (bWorldUpdate) this->UpdateWorldMatrix();
+	}
+
+	/// [hs̃NH[^jI擾
+	D3DXQUATERNION GetWorldQuaternion() const requires Policy::bRotation
+	{
+		D3DXQUATERNION result;
+		D3DXMATRIX     rotationMatrix = this->worldMatrix;
+
+		// gk ( |V[ł͂̂܂ )
+		if constexpr (Policy::bScale)
+		{
+			const D3DXVECTOR3 scale = this->GetWorldScale();
+			BasicTransform::ScaleRows(&rotationMatrix, 1.0f / scale.x, 1.0f / scale.y, 1.0f / scale.z);
+		}
+
+		D3DXQuaternionRotationMatrix(&result, &rotationMatrix);
+
+		return result;
+	}
+
+
+public:
+	/***** scale ( bScale ̂݁A|V[ł͏ 1 ) *****/
+
+	/// [hs̃XP[擾
+	D3DXVECTOR3 GetWorldScale() const
+	{
+		return BasicTransform::ExtractScale(this->worldMatrix);
+	}
+
+	/// [Js̃XP[擾
+	D3DXVECTOR3 GetLocalScale() const
+	{
+		return BasicTransform::ExtractScale(this->localMatrix);
+	}
+
+	/// <summary>
+	/// [Js̃XP[Zbg ( ψ )
+	/// </summary>
+	/// <param name="scale">		ZbgXP[ </param>
+	/// <param name="bWorldUpdate">	[hsXV邩 (ftHg true) </param>
+	void SetLocalScale(float scale, bool bWorldUpdate = true) requires Policy::bScale
+	{
+		const D3DXVECTOR3 current = this->GetLocalScale();
+		BasicTransform::ScaleRows(&this->localMatrix, scale / current.x, scale / current.y, scale / current.z);
+
+		if (bWorldUpdate) this->UpdateWorldMatrix();
+	}
+
+	/// <summary>
+	/// [Js̃XP[Zbg
+	/// </summary>
+	/// <param name="(x, y, z)">	ZbgXP[ </param>
+	/// <param name="bWorldUpdate">	[hsXV邩 (ftHg true) </param>
+	void SetLocalScale(float x, float y, float z, bool bWorldUpdate = true) requires (Policy::bScale && !Policy::bUniformScale)
+	{
+		const D3DXVECTOR3 scale = this->GetLocalScale();
+		BasicTransform::ScaleRows(&this->localMatrix, x / scale.x, y / scale.y, z / scale.z);
+
+		if (bWorldUpdate) this->UpdateWorldMatrix();
+	}
+
+
+public:
+	/***** direction *****/
+
+	// z direction ( world )
+	D3DXVECTOR3 GetForwardVector() const { return BasicTransform::ExtractDirection(this->worldMatrix, 2); }
+
+	// y direction ( world )
+	D3DXVECTOR3 GetUpVector()      const { return BasicTransform::ExtractDirection(this->worldMatrix, 1); }
+
+	// x direction ( world )
+	D3DXVECTOR3 GetRightVector()   const { return BasicTransform::ExtractDirection(this->worldMatrix, 0); }
+
+	// z direction ( local )
+	D3DXVECTOR3 GetLocalForwardVector() const { return BasicTransform::ExtractDirection(this->localMatrix, 2); }
+
+	// y direction ( local )
+	D3DXVECTOR3 GetLocalUpVector()      const { return BasicTransform::ExtractDirection(this->localMatrix, 1); }
+
+	// x direction ( local )
+	D3DXVECTOR3 GetLocalRightVector()   const { return BasicTransform::ExtractDirection(this->localMatrix, 0); }
+
+
+public:
+	/****** matrix updater *****/
+
+	// [hsXV
+	void UpdateWorldMatrix(bool bCallEventUpdated = true)
+	{
+		// g̃[hsvZ
+		this->CalcWorldMatrix();
+
+		// qXV
+		this->UpdateDescendantsWorldMatrix();
+
+		// Cxg
+		if constexpr (Policy::bEvent)
+		{
+			if (bCallEventUpdated) Policy::EventTransformUpdated(this);
+		}
+	}
+
+	// [JsXV
+	void UpdateLocalMatrix(bool bCallEventUpdated = true)
+	{
+		// eꍇ
+		if (this->parentTransform)
+		{
+			D3DXMATRIX parentInverse;
+			BasicTransform::Inverse(&parentInverse, this->parentTransform->worldMatrix);
+
+			BasicTransform::Multiply(&this->localMatrix, this->worldMatrix, parentInverse);
+		}
+		// eȂꍇ
+		else
+		{
+			this->localMatrix = this->worldMatrix;
+		}
+
+		// qXV
+		this->UpdateDescendantsWorldMatrix();
+
+		// Cxg
+		if constexpr (Policy::bEvent)
+		{
+			if (bCallEventUpdated) Policy::EventTransformUpdated(this);
+		}
+	}
+
+
+private:
+	/***** XV *****/
+
+	// [JsƐe烏[hsvZ ( ĝ )
+	void CalcWorldMatrix()
+	{
+		// eꍇ
+		if (this->parentTransform)
+		{
+			BasicTransform::Multiply(&this->worldMatrix, this->localMatrix, this->parentTransform->worldMatrix);
+		}
+		// eȂꍇ
+		else
+		{
+			this->worldMatrix = this->localMatrix;
+		}
+	}
+
+	// q̃[hsXV ( ċAKwɑACxg͎qɔ )
+	void UpdateDescendantsWorldMatrix()
+	{
+		// t͉Ȃ
+		if (this->childrenTransforms.empty()) return;
+
+		// p̔z؂ ( CxgōXVĂȂ悤 move  )
+		thread_local std::vector<BasicTransform*> buffer;
+		std::vector<BasicTransform*> order = std::move(buffer);
+		order.clear();
+
+		// Kw ( D ) ɕׂȂvZ
+		order.insert(order.end(), this->childrenTransforms.begin(), this->childrenTransforms.end());
+
+		for (size_t i = 0; i < order.size(); i++)
+		{
+			BasicTransform* const node = order[i];
+
+			node->CalcWorldMatrix();
+			order.insert(order.end(), node->childrenTransforms.begin(), node->childrenTransforms.end());
+		}
+
+		// Cxg ( [Aq͐e )
+		if constexpr (Policy::bEvent)
+		{
+			for (size_t i = order.size(); i-- > 0;)
+			{
+				Policy::EventTransformUpdated(order[i]);
+			}
+		}
+
+		buffer = std::move(order);
+	}
+
+
+private:
+	/***** |V[ʂ̌vZ *****/
+
+	// out = a * b
+	static void Multiply(D3DXMATRIX* const out, const D3DXMATRIX& a, const D3DXMATRIX& b)
+	{
+		if constexpr (!Policy::bRotation && !Policy::bScale)
+		{
+			// sړm͑Ẑ
+			*out = a;
+			out->_41 += b._41;
+			out->_42 += b._42;
+			out->_43 += b._43;
+		}
+		else if constexpr (!Policy::bScale || Policy::bUniformScale)
+		{
+			BasicTransform::MultiplyAffine(out, a, b);
+		}
+		else
+		{
+			D3DXMatrixMultiply(out, &a, &b);
+		}
+	}
+
+	// AtBs񓯎m̐ ( 3x3 + sړ )
+	static void MultiplyAffine(D3DXMATRIX* const out, const D3DXMATRIX& a, const D3DXMATRIX& b)
+	{
+		D3DXMATRIX result;
+
+		result._11 = a._11 * b._11 + a._12 * b._21 + a._13 * b._31;
+		result._12 = a._11 * b._12 + a._12 * b._22 + a._13 * b._32;
+		result._13 = a._11 * b._13 + a._12 * b._23 + a._13 * b._33;
+		result._21 = a._21 * b._11 + a._22 * b._21 + a._23 * b._31;
+		result._22 = a._21 * b._12 + a._22 * b._22 + a._23 * b._32;
+		result._23 = a._21 * b._13 + a._22 * b._23 + a._23 * b._33;
+		result._31 = a._31 * b._11 + a._32 * b._21 + a._33 * b._31;
+		result._32 = a._31 * b._12 + a._32 * b._22 + a._33 * b._32;
+		result._33 = a._31 * b._13 + a._32 * b._23 + a._33 * b._33;
+		result._41 = a._41 * b._11 + a._42 * b._21 + a._43 * b._31 + b._41;
+		result._42 = a._41 * b._12 + a._42 * b._22 + a._43 * b._32 + b._42;
+		result._43 = a._41 * b._13 + a._42 * b._23 + a._43 * b._33 + b._43;
+
+		result._14 = result._24 = result._34 = 0.0f;
+		result._44 = 1.0f;
+
+		*out = result;
+	}
+
+	// ts
+	static void Inverse(D3DXMATRIX* const out, const D3DXMATRIX& m)
+	{
+		if constexpr (!Policy::bRotation && !Policy::bScale)
+		{
+			// sړ̋t͕]̂
+			D3DXMatrixIdentity(out);
+			out->_41 = -m._41;
+			out->_42 = -m._42;
+			out->_43 = -m._43;
+		}
+		else if constexpr (!Policy::bScale || Policy::bUniformScale)
+		{
+			// ]͓]u ( ψgkȂ炳 1 / s^2 )
+			float invScaleSq = 1.0f;
+			if constexpr (Policy::bScale)
+			{
+				invScaleSq = 1.0f / (m._11 * m._11 + m._12 * m._12 + m._13 * m._13);
+			}
+
+			out->_11 = m._11 * invScaleSq; out->_12 = m._21 * invScaleSq; out->_13 = m._31 * invScaleSq; out->_14 = 0.0f;
+			out->_21 = m._12 * invScaleSq; out->_22 = m._22 * invScaleSq; out->_23 = m._32 * invScaleSq; out->_24 = 0.0f;
+			out->_31 = m._13 * invScaleSq; out->_32 = m._23 * invScaleSq; out->_33 = m._33 * invScaleSq; out->_34 = 0.0f;
+
+			out->_41 = -(m._41 * out->_11 + m._42 * out->_21 + m._43 * out->_31);
+			out->_42 = -(m._41 * out->_12 + m._42 * out->_22 + m._43 * out->_32);
+			out->_43 = -(m._41 * out->_13 + m._42 * out->_23 + m._43 * out->_33);
+			out->_44 = 1.0f;
+		}
+		else
+		{
+			D3DXMatrixInverse(out, nullptr, &m);
+		}
+	}
+
+	// s̃XP[
+	static D3DXVECTOR3 ExtractScale(const D3DXMATRIX& m)
+	{
+		if constexpr (!Policy::bScale)
+		{
+			return D3DXVECTOR3(1.0f, 1.0f, 1.0f);
+		}
+		else if constexpr (Policy::bUniformScale)
+		{
+			// sqrt ͈
+			const float scale = sqrtf(m._11 * m._11 + m._12 * m._12 + m._13 * m._13);
+			return D3DXVECTOR3(scale, scale, scale);
+		}
+		else
+		{
+			D3DXVECTOR3 directions[3] =
+			{
+				{m._11, m._12, m._13},
+				{m._21, m._22, m._23},
+				{m._31, m._32, m._33}
+			};
+
+			return D3DXVECTOR3
+			(
+				D3DXVec3Length(&directions[0]),
+				D3DXVec3Length(&directions[1]),
+				D3DXVec3Length(&directions[2])
+			);
+		}
+	}
+
+	// Kꂽ ( row : 0 = x, 1 = y, 2 = z )
+	static D3DXVECTOR3 ExtractDirection(const D3DXMATRIX& m, int row)
+	{
+		if constexpr (!Policy::bRotation)
+		{
+			// ]Ȃ̂Ŏ͌Œ
+			return D3DXVECTOR3(row == 0 ? 1.0f : 0.0f, row == 1 ? 1.0f : 0.0f, row == 2 ? 1.0f : 0.0f);
+		}
+		else
+		{
+			D3DXVECTOR3 result(m.m[row][0], m.m[row][1], m.m[row][2]);
+
+			// gkΐKς
+			if constexpr (Policy::bScale)
+			{
+				D3DXVec3Normalize(&result, &result);
+			}
+
+			return result;
+		}
+	}
+
+	// sƂɊgk
+	static void ScaleRows(D3DXMATRIX* const m, float x, float y, float z)
+	{
+		m->_11 *= x; m->_12 *= x; m->_13 *= x;
+		m->_21 *= y; m->_22 *= y; m->_23 *= y;
+		m->_31 *= z; m->_32 *= z; m->_33 *= z;
+	}
+
+	// ]sƃXP[ 3x3 Zbg ( W͂̂܂ )
+	void SetLocalBasis(const D3DXMATRIX* const rotationMatrix, const D3DXVECTOR3& scale)
+	{
+		const float x = this->localMatrix._41,
+		            y = this->localMatrix._42,
+		            z = this->localMatrix._43;
+
+		this->localMatrix = *rotationMatrix;
+
+		if constexpr (Policy::bScale)
+		{
+			BasicTransform::ScaleRows(&this->localMatrix, scale.x, scale.y, scale.z);
+		}
+
+		this->localMatrix._41 = x;
+		this->localMatrix._42 = y;
+		this->localMatrix._43 = z;
+	}
+
+
+private:
+	D3DXMATRIX worldMatrix;
+
+	D3DXMATRIX localMatrix;
+
+	// q
+	std::vector<BasicTransform*> childrenTransforms;
+
+	// e
+	BasicTransform* parentTransform;
+};
+
+// |V[ʂ̕ʖ ( S@\ + zCxg͏]ʂ Transform g )
+using FullTransform         = BasicTransform<FullTransformPolicy>;
+using RigidTransform        = BasicTransform<RigidTransformPolicy>;
+using UniformScaleTransform = BasicTransform<UniformScaleTransformPolicy>;
+using TranslationTransform  = BasicTransform<TranslationTransformPolicy>;
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include <new>
+#include <cstring>
+#include <type_traits>
+#pragma once
+
+/// <summary>
+/// Ȃvf͎g̒ɎAInlineCapacity 𒴂Ƃq[vֈڂz ( ڂ clear() ł߂Ȃ )
+/// |C^Ȃǂ̒PȌ^p ( memcpy ňړ )
+/// 
+/// 64bit Ń|C^ 2 Ȃ std::vector Ɠ 24 byte ( vf̗̈ 16 +  4 + lߕ )
+/// </summary>
+template<class T, unsigned int InlineCapacity>
+class InlineVector
+{
+	static_assert(std::is_trivially_copyable_v<T>, "InlineVector holds trivially copyable types only.");
+	static_assert(InlineCapacity > 0, "InlineVector needs at least one inline element.");
+
+public:
+	/***** ctor, dtor *****/
+	InlineVector() : count(0) {}
+
+	~InlineVector()
+	{
+		if (this->IsHeap()) ::operator delete(this->heap.items);
+	}
+
+	InlineVector(InlineVector&& rh) noexcept : count(0)
+	{
+		this->MoveFrom(rh);
+	}
+
+	InlineVector& operator = (InlineVector&& rh) noexcept
+	{
+		if (this != &rh)
+		{
+			if (this->IsHeap()) ::operator delete(this->heap.items);
+			this->count = 0;
+			this->MoveFrom(rh);
+		}
+		return *this;
+	}
+
+	InlineVector(const InlineVector&)            = delete;
+	InlineVector& operator=(const InlineVector&) = delete;
+
+public:
+	/***** vf *****/
+
+	// 
+	size_t size() const { return this->count & CountMask; }
+
+	// 
+	bool empty() const { return this->size() == 0; }
+
+	// ̗e ( g̒Ȃ InlineCapacity )
+	size_t capacity() const { return this->IsHeap() ? this->heap.capacity : InlineCapacity; }
+
+	// 擪
+	T*       data()       { return this->IsHeap() ? this->heap.items : this->inlineItems; }
+	const T* data() const { return this->IsHeap() ? this->heap.items : this->inlineItems; }
+
+	T*       begin()       { return this->data(); }
+	T*       end()         { return this->data() + this->size(); }
+	const T* begin() const { return this->data(); }
+	const T* end()   const { return this->data() + this->size(); }
+
+	T&       operator [] (size_t index)       { return this->data()[index]; }
+	const T& operator [] (size_t index) const { return this->data()[index]; }
+
+	T&       back()       { return this->data()[this->size() - 1]; }
+	const T& back() const { return this->data()[this->size() - 1]; }
+
+	// ɒǉ ( Ȃ 2 {ɐL΂ )
+	void push_back(const T& value)
+	{
+		const size_t size = this->size();
+		if (size == this->capacity())
+		{
+			// value g̗vfłȂ悤ɐɎʂ
+			const T copy = value;
+			this->Grow(size * 2);
+			this->data()[size] = copy;
+		}
+		else
+		{
+			this->data()[size] = value;
+		}
+		this->count++;
+	}
+
+	// 
+	void pop_back() { this->count--; }
+
+	// Sď ( q[v̗͎̈c )
+	void clear() { this->count &= HeapFlag; }
+
+	// eʂm
+	void reserve(size_t capacity)
+	{
+		if (capacity > this->capacity()) this->Grow(capacity);
+	}
+
+private:
+	// count ̍ŏʃrbg̓q[vɈڂ̈
+	static constexpr unsigned int HeapFlag  = 0x80000000u;
+	static constexpr unsigned int CountMask = 0x7fffffffu;
+
+	bool IsHeap() const { return (this->count & HeapFlag) != 0; }
+
+	// q[vֈڂ ( L΂ )
+	void Grow(size_t capacity)
+	{
+		T* const items = static_cast<T*>(::operator new(sizeof(T) * capacity));
+		std::memcpy(items, this->data(), sizeof(T) * this->size());
+
+		if (this->IsHeap()) ::operator delete(this->heap.items);
+
+		this->heap.items    = items;
+		this->heap.capacity = static_cast<unsigned int>(capacity);
+		this->count        |= HeapFlag;
+	}
+
+	// rh ̒g炤 ( rh ͋̎g̒ɖ߂ )
+	void MoveFrom(InlineVector& rh)
+	{
+		if (rh.IsHeap()) this->heap = rh.heap;
+		else             std::memcpy(this->inlineItems, rh.inlineItems, sizeof(T) * rh.size());
+
+		this->count = rh.count;
+		rh.count    = 0;
+	}
+
+private:
+	union
+	{
+		T inlineItems[InlineCapacity];
+
+		struct
+		{
+			T*           items;
+			unsigned int capacity;
+		} heap;
+	};
+
+	//  ( ŏʃrbg̓q[v̈ )
+	unsigned int count;
+};
\ No newline at end of file
@@ -0,0 +1,335 @@
+#include "RotationArray.hpp"
+#include "TransformSimd.hpp"
+#include <cmath>
+
+namespace
+{
+    /***** Z̕i ( floatASSE2AAVX2 œOAZ̏Ԃ Rotation Ɠ ) *****/
+
+    inline float VAdd(float a, float b) { return a + b; }
+    inline float VSub(float a, float b) { return a - b; }
+    inline float VMul(float a, float b) { return a * b; }
+    inline float VFloor(float a)        { return floorf(a); }
+
+#ifdef TRANSFORM_SIMD_SSE2
+    inline __m128 VAdd(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+    inline __m128 VSub(__m128 a, __m128 b) { return _mm_sub_ps(a, b); }
+    inline __m128 VMul(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+
+    // SSE4.1  floor g킸ɐ؂̂ ( ֐؂̂ĂĂA傫 1  )
+    // 2^23 ȏ float ͊ɐ ( int32 Ɏ܂ȂƂ ) Ȃ̂ł̂܂܁ANaN ̂܂ ( floorf Ɠ )
+    inline __m128 VFloor(__m128 a)
+    {
+        const __m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+        const __m128 floored   = _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, a), _mm_set1_ps(1.0f)));
+
+        const __m128 magnitude = _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+        const __m128 bSmall    = _mm_cmplt_ps(magnitude, _mm_set1_ps(8388608.0f));
+        return _mm_or_ps(_mm_and_ps(bSmall, floored), _mm_andnot_ps(bSmall, a));
+    }
+#endif
+
+#ifdef TRANSFORM_SIMD_AVX2
+    inline __m256 VAdd(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+    inline __m256 VSub(__m256 a, __m256 b) { return _mm256_sub_ps(a, b); }
+    inline __m256 VMul(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+    inline __m256 VFloor(__m256 a)         { return _mm256_floor_ps(a); }
+#endif
+
+    // Svf𓯂l
+    template<class V> V VSplat(float value);
+    template<> inline float VSplat<float>(float value) { return value; }
+#ifdef TRANSFORM_SIMD_SSE2
+    template<> inline __m128 VSplat<__m128>(float value) { return _mm_set1_ps(value); }
+#endif
+#ifdef TRANSFORM_SIMD_AVX2
+    template<> inline __m256 VSplat<__m256>(float value) { return _mm256_set1_ps(value); }
+#endif
+
+    /// <summary>
+    /// a[i] = op(a[i])  AVX2  8 ASSE2  4 A[ 1 
+    /// </summary>
+    template<class Op>
+    void ForEach(float* const a, size_t count, Op op)
+    {
+        size_t i = 0;
+#ifdef TRANSFORM_SIMD_AVX2
+        for (; i + 8 <= count; i += 8) _mm256_storeu_ps(a + i, op(_mm256_loadu_ps(a + i)));
+#endif
+#ifdef TRANSFORM_SIMD_SSE2
+        for (; i + 4 <= count; i += 4) _mm_storeu_ps(a + i, op(_mm_loadu_ps(a + i)));
+#endif
+        for (; i < count; i++) a[i] = op(a[i]);
+    }
+
+    /// <summary>
+    /// a[i] = op(a[i], b[i])  AVX2  8 ASSE2  4 A[ 1 
+    /// </summary>
+    template<class Op>
+    void ForEach(float* const a, const float* const b, size_t count, Op op)
+    {
+        size_t i = 0;
+#ifdef TRANSFORM_SIMD_AVX2
+        for (; i + 8 <= count; i += 8) _mm256_storeu_ps(a + i, op(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+#endif
+#ifdef TRANSFORM_SIMD_SSE2
+        for (; i + 4 <= count; i += 4) _mm_storeu_ps(a + i, op(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+#endif
+        for (; i < count; i++) a[i] = op(a[i], b[i]);
+    }
+}
+
+RotationArray::RotationArray()
+{
+}
+
+RotationArray::RotationArray(size_t count)
+{
+    this->Resize(count);
+}
+
+RotationArray::RotationArray(std::span<const Rotation> rotations)
+{
+    this->Reserve(rotations.size());
+    for (const Rotation& rotation : rotations) this->PushBack(rotation);
+}
+
+RotationArray::~RotationArray()
+{
+}
+
+/**************************************** vf ****************************************/
+
+size_t RotationArray::GetSize() const
+{
+    return this->yaws.size();
+}
+
+void RotationArray::Resize(size_t count)
+{
+    this->yaws.resize(count, 0.0f);
+    this->pitches.resize(count, 0.0f);
+    this->rolls.resize(count, 0.0f);
+}
+
+void RotationArray::Reserve(size_t count)
+{
+    this->yaws.reserve(count);
+    this->pitches.reserve(count);
+    this->rolls.reserve(count);
+}
+
+void RotationArray::Clear()
+{
+    this->yaws.clear();
+    this->pitches.clear();
+    this->rolls.clear();
+}
+
+void RotationArray::PushBack(const Rotation& rotation)
+{
+    this->yaws.push_back(rotation.yaw);
+    this->pitches.push_back(rotation.pitch);
+    this->rolls.push_back(rotation.roll);
+}
+
+Rotation RotationArray::Get(size_t index) const
+{
+    return Rotation(this->yaws[index], this->pitches[index], this->rolls[index]);
+}
+
+void RotationArray::Set(size_t index, const Rotation& rotation)
+{
+    this->yaws[index]    = rotation.yaw;
+    this->pitches[index] = rotation.pitch;
+    this->rolls[index]   = rotation.roll;
+}
+
+std::span<float> RotationArray::GetYaws()
+{
+    return this->yaws;
+}
+
+std::span<float> RotationArray::GetPitches()
+{
+    return this->pitches;
+}
+
+std::span<float> RotationArray::GetRolls()
+{
+    return this->rolls;
+}
+
+std::span<const float> RotationArray::GetYaws() const
+{
+    return this->yaws;
+}
+
+std::span<const float> RotationArray::GetPitches() const
+{
+    return this->pitches;
+}
+
+std::span<const float> RotationArray::GetRolls() const
+{
+    return this->rolls;
+}
+
+bool RotationArray::CopyTo(std::span<Rotation> out) const
+{
+    if (out.size() != this->GetSize())
+    {
+        OutputDebugFormat("RotationArray.CopyTo : size does not match.\n");
+        return false;
+    }
+
+    for (size_t i = 0; i < out.size(); i++) out[i] = this->Get(i);
+
+    return true;
+}
+
+
+
+/**************************************** Z ****************************************/
+
+bool RotationArray::Add(const RotationArray& rh)
+{
+    if (rh.GetSize() != this->GetSize())
+    {
+        OutputDebugFormat("RotationArray.Add : size does not match.\n");
+        return false;
+    }
+
+    auto add = [](auto a, auto b) { return VAdd(a, b); };
+
+    ForEach(this->yaws.data(),    rh.yaws.data(),    this->GetSize(), add);
+    ForEach(this->pitches.data(), rh.pitches.data(), this->GetSize(), add);
+    ForEach(this->rolls.data(),   rh.rolls.data(),   this->GetSize(), add);
+
+    return true;
+}
+
+void RotationArray::Add(const Rotation& rh)
+{
+    auto add = [](float value) { return [value](auto a) { return VAdd(a, VSplat<decltype(a)>(value)); }; };
+
+    ForEach(this->yaws.data(),    this->GetSize(), add(rh.yaw));
+    ForEach(this->pitches.data(), this->GetSize(), add(rh.pitch));
+    ForEach(this->rolls.data(),   this->GetSize(), add(rh.roll));
+}
+
+bool RotationArray::AddScaled(const RotationArray& rh, float scale)
+{
+    if (rh.GetSize() != this->GetSize())
+    {
+        OutputDebugFormat("RotationArray.AddScaled : size does not match.\n");
+        return false;
+    }
+
+    auto addScaled = [scale](auto a, auto b) { return VAdd(a, VMul(b, VSplat<decltype(a)>(scale))); };
+
+    ForEach(this->yaws.data(),    rh.yaws.data(),    this->GetSize(), addScaled);
+    ForEach(this->pitches.data(), rh.pitches.data(), this->GetSize(), addScaled);
+    ForEach(this->rolls.data(),   rh.rolls.data(),   this->GetSize(), addScaled);
+
+    return true;
+}
+
+void RotationArray::Scale(float scale)
+{
+    auto multiply = [scale](auto a) { return VMul(a, VSplat<decltype(a)>(scale)); };
+
+    ForEach(this->yaws.data(),    this->GetSize(), multiply);
+    ForEach(this->pitches.data(), this->GetSize(), multiply);
+    ForEach(this->rolls.data(),   this->GetSize(), multiply);
+}
+
+bool RotationArray::Lerp(const RotationArray& to, float t)
+{
+    if (to.GetSize() != this->GetSize())
+    {
+        OutputDebugFormat("RotationArray.Lerp : size does not match.\n");
+        return false;
+    }
+
+    auto lerp = [t](auto a, auto b) { return VAdd(a, VMul(VSub(b, a), VSplat<decltype(a)>(t))); };
+
+    ForEach(this->yaws.data(),    to.yaws.data(),    this->GetSize(), lerp);
+    ForEach(this->pitches.data(), to.pitches.data(), this->GetSize(), lerp);
+    ForEach(this->rolls.data(),   to.rolls.data(),   this->GetSize(), lerp);
+
+    return true;
+}
+
+void RotationArray::Normalize(bool degree)
+{
+    const float unit    = (degree ? 180.0f : D3DX_PI);
+    const float period  = 2 * unit;
+    const float inverse = 1.0f / period;
+
+    // v - period * floor((v + unit) / period) ( 򖳂Aʂ -unit ȏ unit  )
+    auto wrap = [unit, period, inverse](auto a)
+    {
+        using V = decltype(a);
+        const V turns = VFloor(VMul(VAdd(a, VSplat<V>(unit)), VSplat<V>(inverse)));
+        return VSub(a, VMul(turns, VSplat<V>(period)));
+    };
+
+    ForEach(this->yaws.data(),    this->GetSize(), wrap);
+    ForEach(this->pitches.data(), this->GetSize(), wrap);
+    ForEach(this->rolls.data(),   this->GetSize(), wrap);
+}
+
+void RotationArray::ToRadian()
+{
+    // Rotation::ToRadian() ƓW
+    this->Scale(3.141592654f / 180.0f);
+}
+
+void RotationArray::ToDegree()
+{
+    // Rotation::ToDegree() ƓW
+    this->Scale(180.0f / 3.141592654f);
+}
+
+
+
+/**************************************** NH[^jI ****************************************/
+
+bool RotationArray::ToQuaternions(std::span<D3DXQUATERNION> out) const
+{
+    if (out.size() != this->GetSize())
+    {
+        OutputDebugFormat("RotationArray.ToQuaternions : size does not match.\n");
+        return false;
+    }
+
+    // Ƃ̔zɓǂނȂ̂ŁA[v̓RpC܂Ƃ߂₷
+    for (size_t i = 0; i < out.size(); i++)
+    {
+        const float halfYaw   = this->yaws[i]    * 0.5f;
+        const float halfPitch = this->pitches[i] * 0.5f;
+        const float halfRoll  = this->rolls[i]   * 0.5f;
+
+        const float sy = sinf(halfYaw),   cy = cosf(halfYaw);
+        const float sp = sinf(halfPitch), cp = cosf(halfPitch);
+        const float sr = sinf(halfRoll),  cr = cosf(halfRoll);
+
+        out[i].x = cy * sp * cr + sy * cp * sr;
+        out[i].y = sy * cp * cr - cy * sp * sr;
+        out[i].z = cy * cp * sr - sy * sp * cr;
+        out[i].w = cy * cp * cr + sy * sp * sr;
+    }
+
+    return true;
+}
+
+void RotationArray::FromQuaternions(std::span<const D3DXQUATERNION> quaternions)
+{
+    this->Resize(quaternions.size());
+
+    for (size_t i = 0; i < quaternions.size(); i++)
+    {
+        this->Set(i, Rotation::QuatToRotation(&quaternions[i]));
+    }
+}
\ No newline at end of file
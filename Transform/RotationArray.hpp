@@ -0,0 +1,113 @@
+#include <vector>
+#include <span>
+#include <d3dx9.h>
+#include "Transform.hpp"
+#pragma once
+
+/// <summary>
+/// Rotation ̔z yaw, pitch, roll ʁX̔z ( SoA ) Ŏ
+/// ZAgkAԁAKȂǂzŜ SIMD ( SSE2 / AVX2 ) ł܂Ƃ߂čs
+/// 
+/// ʂ Rotation ̓Zƈv ( Normalize()  fmodf ̑ floor Ő܂Ԃ̂Ō덷͈̔͂ňv )
+/// ̔zgZ͐ȂΉ false
+/// </summary>
+class RotationArray
+{
+public:
+	/***** ctor, dtor *****/
+	RotationArray();
+	RotationArray(size_t count);
+	RotationArray(std::span<const Rotation> rotations);
+	~RotationArray();
+
+public:
+	/***** vf *****/
+
+	// 
+	size_t GetSize() const;
+
+	// ς (  0 )
+	void Resize(size_t count);
+
+	// mۂ
+	void Reserve(size_t count);
+
+	// Sď
+	void Clear();
+
+	// ɒǉ
+	void PushBack(const Rotation& rotation);
+
+	// 擾
+	Rotation Get(size_t index) const;
+
+	// Zbg
+	void Set(size_t index, const Rotation& rotation);
+
+	// e̔z ( ړǂݏꍇ )
+	std::span<float>       GetYaws();
+	std::span<float>       GetPitches();
+	std::span<float>       GetRolls();
+	std::span<const float> GetYaws()    const;
+	std::span<const float> GetPitches() const;
+	std::span<const float> GetRolls()   const;
+
+	// Rotation ̔z֏o ( Ȃ false )
+	bool CopyTo(std::span<Rotation> out) const;
+
+public:
+	/***** Z ( Svf ) *****/
+
+	// vfƂɑ ( Rotation::operator += )
+	bool Add(const RotationArray& rh);
+
+	// Svfɓ]𑫂
+	void Add(const Rotation& rh);
+
+	// vfƂ rh * scale 𑫂 ( px * oߎԂ̐ϕȂ )
+	bool AddScaled(const RotationArray& rh, float scale);
+
+	// Svfgk ( Rotation::operator *= )
+	void Scale(float scale);
+
+	/// <summary>
+	/// vfƂ to ֕ ( this + (to - this) * tApx̐܂Ԃ͍lȂ )
+	/// </summary>
+	/// <param name="to">	Ԑ </param>
+	/// <param name="t">	ԌW ( 0 ŎgA1  to ) </param>
+	/// <returns> Ă </returns>
+	bool Lerp(const RotationArray& to, float t);
+
+	/// <summary>
+	/// -PI ~ +PI ( xȂ -180 ~ +180 ) ͈̔͂ɐK ( Rotation::Normalize() Ɠ͈ )
+	/// fmodf ƕ̑ v - 2unit * floor((v + unit) / 2unit) Ő܂Ԃ
+	/// Rotation::Normalize() Ƃ̍ (|v| + 2unit) * NormalizeRelativeError ȓ ( [ -unit  +unit ͓Ƃ )
+	/// ʂۂ߂ł̍̕ -unit ~ +unit ͂ݏoƂ
+	/// Ӗ̂͂ |v| < 2^23 (  8e6 ) ܂ŁA傫l AVX2ASSE2A[̂ǂ̌oHłʂɂȂ
+	/// </summary>
+	/// <param name="degree"> x@ </param>
+	void Normalize(bool degree = false);
+
+	// Normalize()  Rotation::Normalize() Ƃ̍ ( (|v| + 2unit) ɑ΂銄A2^-22 )
+	static constexpr float NormalizeRelativeError = 2.4e-7f;
+
+	// Svfʓx@ɕϊ ( x  WA )
+	void ToRadian();
+
+	// Svfx@ɕϊ ( WA  x )
+	void ToDegree();
+
+public:
+	/***** NH[^jI *****/
+
+	// NH[^jI ( WAAD3DXQuaternionRotationYawPitchRoll Ɠ )
+	bool ToQuaternions(std::span<D3DXQUATERNION> out) const;
+
+	// NH[^jI ( Rotation::QuatToRotation ƓA quaternions ɍ킹 )
+	void FromQuaternions(std::span<const D3DXQUATERNION> quaternions);
+
+private:
+	std::vector<float> yaws;
+	std::vector<float> pitches;
+	std::vector<float> rolls;
+};
\ No newline at end of file
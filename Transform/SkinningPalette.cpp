@@ -0,0 +1,260 @@
+#include "SkinningPalette.hpp"
+#include "TransformTrace.hpp"
+#include "TransformSimd.hpp"
+#include <algorithm>
+
+SkinningPalette::SkinningPalette(Transform* const skeletonRoot, Format format)
+{
+    this->skeletonRoot        = skeletonRoot;
+    this->meshRoot            = nullptr;
+    this->format              = format;
+    this->seenMeshRootVersion = 0;
+
+    D3DXMatrixIdentity(&this->meshRootInverse);
+}
+
+SkinningPalette::~SkinningPalette()
+{
+}
+
+/**************************************** {[ ****************************************/
+
+size_t SkinningPalette::CollectBones()
+{
+    this->bones.clear();
+    this->inverseBindMatrices.clear();
+
+    if (!this->skeletonRoot)
+    {
+        OutputDebugFormat("SkinningPalette.CollectBones : skeleton root is nullptr.\n");
+        this->ResizeOutput();
+        return 0;
+    }
+
+    // [D ( s ) ɕׂAċA͂Ȃ
+    std::vector<Transform*> stack;
+    stack.push_back(this->skeletonRoot);
+
+    while (!stack.empty())
+    {
+        Transform* const bone = stack.back();
+        stack.pop_back();
+
+        this->bones.push_back(bone);
+
+        // qtɐςŁA擪̎qo
+        const auto children = bone->GetChildren();
+        stack.insert(stack.end(), children.rbegin(), children.rend());
+    }
+
+    // ̎poCh|[Yɂ
+    this->inverseBindMatrices.resize(this->bones.size());
+    for (size_t i = 0; i < this->bones.size(); i++)
+    {
+        D3DXMatrixInverse(&this->inverseBindMatrices[i], nullptr, &this->bones[i]->ComputeWorldMatrixNow());
+    }
+
+    this->ResizeOutput();
+
+    return this->bones.size();
+}
+
+bool SkinningPalette::SetBones(std::span<Transform* const> bones, std::span<const D3DXMATRIX> inverseBindMatrices)
+{
+    if (bones.size() != inverseBindMatrices.size())
+    {
+        OutputDebugFormat("SkinningPalette.SetBones : bone count and inverse bind matrix count differ.\n");
+        return false;
+    }
+
+    for (Transform* const bone : bones)
+    {
+        if (!bone)
+        {
+            OutputDebugFormat("SkinningPalette.SetBones : bone is nullptr.\n");
+            return false;
+        }
+    }
+
+    this->bones.assign(bones.begin(), bones.end());
+    this->inverseBindMatrices.assign(inverseBindMatrices.begin(), inverseBindMatrices.end());
+
+    this->ResizeOutput();
+
+    return true;
+}
+
+size_t SkinningPalette::GetBoneCount() const
+{
+    return this->bones.size();
+}
+
+const std::vector<Transform*>& SkinningPalette::GetBones() const
+{
+    return this->bones;
+}
+
+const std::vector<D3DXMATRIX>& SkinningPalette::GetInverseBindMatrices() const
+{
+    return this->inverseBindMatrices;
+}
+
+Transform* SkinningPalette::GetSkeletonRoot() const
+{
+    return this->skeletonRoot;
+}
+
+
+
+/**************************************** ݒ ****************************************/
+
+void SkinningPalette::SetMeshRoot(Transform* const meshRoot)
+{
+    this->meshRoot            = meshRoot;
+    this->seenMeshRootVersion = 0;
+
+    D3DXMatrixIdentity(&this->meshRootInverse);
+
+    // o͂̊ς̂ŁA Update() őS{[vZ ( nullptr ɖ߂Ƃ )
+    std::fill(this->seenVersions.begin(), this->seenVersions.end(), 0);
+}
+
+Transform* SkinningPalette::GetMeshRoot() const
+{
+    return this->meshRoot;
+}
+
+void SkinningPalette::SetFormat(Format format)
+{
+    if (this->format == format) return;
+
+    this->format = format;
+    this->ResizeOutput();
+}
+
+SkinningPalette::Format SkinningPalette::GetFormat() const
+{
+    return this->format;
+}
+
+
+
+/**************************************** XVAo ****************************************/
+
+size_t SkinningPalette::Update(bool bForce)
+{
+    TRANSFORM_TRACE_SCOPE("SkinningPalette.Update");
+
+    // bṼ[gS{[vZ
+    if (this->meshRoot)
+    {
+        const unsigned int version = this->meshRoot->GetWorldVersion();
+        if (version != this->seenMeshRootVersion)
+        {
+            D3DXMatrixInverse(&this->meshRootInverse, nullptr, &this->meshRoot->GetWorldMatrix());
+            this->seenMeshRootVersion = version;
+            bForce = true;
+        }
+    }
+
+    size_t updated = 0;
+
+    const size_t count = this->bones.size();
+    for (size_t i = 0; i < count; i++)
+    {
+        const unsigned int version = this->bones[i]->GetWorldVersion();
+        if (!bForce && version == this->seenVersions[i]) continue;
+
+        this->seenVersions[i] = version;
+
+        // XLs = toCh * [h ( * bṼ[g̋ts )
+        D3DXMATRIX& skin = this->matrices[i];
+        TransformSimd::MultiplyMatrix(&skin, this->inverseBindMatrices[i], this->bones[i]->GetWorldMatrix());
+        if (this->meshRoot) TransformSimd::MultiplyMatrix(&skin, skin, this->meshRootInverse);
+
+        this->StoreFormat(i);
+        updated++;
+    }
+
+    return updated;
+}
+
+const D3DXMATRIX* SkinningPalette::GetMatrices() const
+{
+    return this->matrices.data();
+}
+
+const float* SkinningPalette::GetMatrices4x3() const
+{
+    return this->matrices4x3.data();
+}
+
+const SkinningPalette::DualQuaternion* SkinningPalette::GetDualQuaternions() const
+{
+    return this->dualQuaternions.data();
+}
+
+const void* SkinningPalette::GetData() const
+{
+    switch (this->format)
+    {
+    case Format::Matrix4x3:      return this->matrices4x3.data();
+    case Format::DualQuaternion: return this->dualQuaternions.data();
+    default:                     return this->matrices.data();
+    }
+}
+
+size_t SkinningPalette::GetDataSize() const
+{
+    switch (this->format)
+    {
+    case Format::Matrix4x3:      return this->matrices4x3.size() * sizeof(float);
+    case Format::DualQuaternion: return this->dualQuaternions.size() * sizeof(DualQuaternion);
+    default:                     return this->matrices.size() * sizeof(D3DXMATRIX);
+    }
+}
+
+void SkinningPalette::ResizeOutput()
+{
+    const size_t count = this->bones.size();
+
+    this->matrices.resize(count);
+    this->matrices4x3.resize(this->format == Format::Matrix4x3 ? count * 12 : 0);
+    this->dualQuaternions.resize(this->format == Format::DualQuaternion ? count : 0);
+
+    //  0 ͎gȂ̂ŁA Update() őS{[vZ
+    this->seenVersions.assign(count, 0);
+}
+
+void SkinningPalette::StoreFormat(size_t index)
+{
+    const D3DXMATRIX& skin = this->matrices[index];
+
+    switch (this->format)
+    {
+    case Format::Matrix4x3:
+        TransformSimd::StoreTransposed4x3(&this->matrices4x3[index * 12], skin);
+        break;
+
+    case Format::DualQuaternion:
+    {
+        D3DXVECTOR3    scale, translation;
+        D3DXQUATERNION q;
+
+        D3DXMatrixDecompose(&scale, &q, &translation, &skin);
+        D3DXQuaternionNormalize(&q, &q);
+
+        // dual = 0.5 * (t, 0) * q
+        DualQuaternion& dq = this->dualQuaternions[index];
+        dq.real   = q;
+        dq.dual.x =  0.5f * ( translation.x * q.w + translation.y * q.z - translation.z * q.y);
+        dq.dual.y =  0.5f * (-translation.x * q.z + translation.y * q.w + translation.z * q.x);
+        dq.dual.z =  0.5f * ( translation.x * q.y - translation.y * q.x + translation.z * q.w);
+        dq.dual.w = -0.5f * ( translation.x * q.x + translation.y * q.y + translation.z * q.z);
+        break;
+    }
+
+    default:
+        break;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include <vector>
+#include <span>
+#include <d3dx9.h>
+#include "Transform.hpp"
+#pragma once
+
+/// <summary>
+/// XPg ( Transform ̕ ) XLjOp̍spbg
+/// toChsAĎA[hs񂪕ς{[x̑ŌvZ
+/// 
+/// g : [hsXV Update()  GetData() / GetDataSize() ̂܂ܒ萔obt@
+/// {[ Transform jOɃpbgj邩ASetBones() ŊO
+/// </summary>
+class SkinningPalette
+{
+public:
+	// o͌`
+	enum class Format : unsigned char
+	{
+		Matrix4x4,		// D3DXMATRIX ( sxNg )
+		Matrix4x3,		// ]u float4 x 3 s ( VF[_[ float4x3 pA4 ڂ͎̂Ă )
+		DualQuaternion,	// fANH[^jI ( gk͎̂Ă )
+	};
+
+	// fANH[^jI ( ] real, sړ dual = 0.5 * t * real )
+	struct DualQuaternion
+	{
+		D3DXQUATERNION real;
+		D3DXQUATERNION dual;
+	};
+
+public:
+	/***** ctor, dtor *****/
+	SkinningPalette(Transform* const skeletonRoot, Format format = Format::Matrix4x4);
+	~SkinningPalette();
+
+public:
+	/***** {[ *****/
+
+	/// <summary>
+	/// XPg̃[g[D̏Ń{[W߂ ( ̎poCh|[Yɂ )
+	/// </summary>
+	/// <returns> {[ </returns>
+	size_t CollectBones();
+
+	/// <summary>
+	/// {[ƋtoChsw ( bṼ{[ɍ킹ꍇ )
+	/// </summary>
+	/// <param name="bones">				{[ ( pbg̕я ) </param>
+	/// <param name="inverseBindMatrices">	toChs ( bones Ɠ ) </param>
+	/// <returns>  </returns>
+	bool SetBones(std::span<Transform* const> bones, std::span<const D3DXMATRIX> inverseBindMatrices);
+
+	// {[
+	size_t GetBoneCount() const;
+
+	// {[擾
+	const std::vector<Transform*>& GetBones() const;
+
+	// toChs擾
+	const std::vector<D3DXMATRIX>& GetInverseBindMatrices() const;
+
+	// XPg̃[g擾
+	Transform* GetSkeletonRoot() const;
+
+public:
+	/***** ݒ *****/
+
+	// bṼ[gw ( w肷ƃbṼ[g猩sóAnullptr Ń[h )
+	void SetMeshRoot(Transform* const meshRoot);
+
+	// bṼ[g擾
+	Transform* GetMeshRoot() const;
+
+	// o͌`w (  Update() őS{[vZ )
+	void SetFormat(Format format);
+
+	// o͌`擾
+	Format GetFormat() const;
+
+public:
+	/***** XVAo *****/
+
+	/// <summary>
+	/// pbgXV ( O񂩂烏[hs񂪕ς{[vZ )
+	/// [hs̍XVIɌĂԂ
+	/// </summary>
+	/// <param name="bForce"> S{[vZ </param>
+	/// <returns> vZ{[ </returns>
+	size_t Update(bool bForce = false);
+
+	// 4x4 ̃pbg ( `Ɋւ炸ɍXV )
+	const D3DXMATRIX* GetMatrices() const;
+
+	// 4x3 ̃pbg ( {[Ƃ float 12 AFormat::Matrix4x3 ̂Ƃ̂ )
+	const float* GetMatrices4x3() const;
+
+	// fANH[^jĨpbg ( Format::DualQuaternion ̂Ƃ̂ )
+	const DualQuaternion* GetDualQuaternions() const;
+
+	// o͌`̃pbg̐擪
+	const void* GetData() const;
+
+	// o͌`̃pbg̃oCg
+	size_t GetDataSize() const;
+
+private:
+	// {[ɍ킹ďo͂mہAS{[vZt
+	void ResizeOutput();
+
+	// XLs񂩂 4x4 ȊǑ`o
+	void StoreFormat(size_t index);
+
+private:
+	// XPg̃[g
+	Transform* skeletonRoot;
+
+	// bṼ[g ( nullptr Ȃ烏[h )
+	Transform* meshRoot;
+
+	// o͌`
+	Format format;
+
+	// {[ ( pbg̕я )
+	std::vector<Transform*> bones;
+
+	// toChs ( bones Ɠ )
+	std::vector<D3DXMATRIX> inverseBindMatrices;
+
+	// O񌩂{[̃[hs̔
+	std::vector<unsigned int> seenVersions;
+
+	// O񌩂bṼ[g̃[hs̔
+	unsigned int seenMeshRootVersion;
+
+	// bṼ[g̋ts
+	D3DXMATRIX meshRootInverse;
+
+	// o
+	std::vector<D3DXMATRIX>     matrices;
+	std::vector<float>          matrices4x3;
+	std::vector<DualQuaternion> dualQuaternions;
+};
\ No newline at end of file
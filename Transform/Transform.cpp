@@ -1,4 +1,51 @@
 #include "Transform.hpp"
+#include "TransformSimd.hpp"
+#include "TransformTrace.hpp"
+#include <unordered_set>
+#include <unordered_map>
+#include <cstring>
+#include <mutex>
+
+// ߂ɎgȂf[^
+struct Transform::ColdData
+{
+    // [hs̋ts̃LbV ( GetInverseWorldMatrix() )
+    D3DXMATRIX inverseWorldMatrix;
+
+    // @p̍s̃LbV ( GetNormalMatrix() )
+    D3DXMATRIX normalMatrix;
+
+    // ̃LbV ( GetBasis(), GetLocalBasis() )
+    Basis basis;
+    Basis localBasis;
+
+    // LbVvZƂ̔ ( 0 Ȃ疢vZAǂރXbh͔łĂΔrŒgǂ )
+    std::atomic<unsigned int> inverseWorldVersion = 0;
+    std::atomic<unsigned int> normalVersion       = 0;
+    std::atomic<unsigned int> basisVersion        = 0;
+    std::atomic<unsigned int> localBasisVersion   = 0;
+
+    // LbVނƂ̔r ( const ̎擾𕡐Xbh瓯ɌĂׂ悤 )
+    std::mutex fillMutex;
+
+    // NH[^jI[h ( SetQuaternionRotationMode() )A]Ɗgk𕪉Ď ( W̓[Js񂻂̂܂ )
+    bool           bQuaternionRotation = false;
+    D3DXQUATERNION localRotation;
+    D3DXVECTOR3    localScale;
+    unsigned int   localRotationVersion = 0;	// Ƃ̃[Js̔ ( ႦΕ )
+};
+
+// `dŐGf[^̗\Z ( 64bit  3 LbVCATransform.hpp ̃o̔zuQ )
+// q𒆂Ɏ 2 葝₵ 1  8 byte ܂ŔF߂ ( 2 ȉł̓q[v̎̃|C^ƗeʂƓ傫Ȃ̂ŕςȂ )
+static_assert
+(
+    sizeof(void*) != 8 || sizeof(Transform) <= 192 + 8 * (TRANSFORM_INLINE_CHILD_CAPACITY > 2 ? TRANSFORM_INLINE_CHILD_CAPACITY - 2 : 0),
+    "Transform exceeds its per-node byte budget."
+);
+
+std::atomic<unsigned int> Transform::frameEpoch       = 0;
+std::atomic<unsigned int> Transform::worldChangeCount = 0;
+std::atomic<unsigned int> Transform::topologyEpoch    = 0;
 
 Transform::Transform() : Transform(nullptr, nullptr) // Ϗ
 {
@@ -11,41 +58,52 @@ Transform::Transform(Transform* parent) : Transform(parent, nullptr) // 
 Transform::Transform(Transform* const parent, D3DXVECTOR3* const location, Rotation* const rotation, D3DXVECTOR3* const scale)
 {
     this->parentTransform = nullptr;
+    this->coldData        = nullptr;
+    this->bWorldDirty     = false;
+    this->bThrottled      = false;
+    this->worldVersion    = 1;
+    this->localVersion    = 1;
+    this->childIndex      = 0;
 
     this->localMatrix = this->CreateWorldTranslationMatrix(location, rotation, scale);
 
-    if (parent)
-    {
-        this->worldMatrix = this->localMatrix * parent->GetWorldMatrix();
-        this->BecomeParents(parent);
-    }
-    else
-    {
-        this->UpdateWorldMatrix();
-    }
+    // 番
+    this->localMatrixClass = location ? MatrixClass::Translation : MatrixClass::Identity;
+    if (rotation) this->localMatrixClass = std::max(this->localMatrixClass, MatrixClass::Rigid);
+    if (scale)    this->localMatrixClass = std::max(this->localMatrixClass, Transform::ClassifyScale(scale));
+
+    this->InitializeHierarchy(parent);
 }
 
 Transform::Transform(Transform* const parent, const D3DXMATRIX* const localMatrix)
 {
     this->parentTransform = nullptr;
+    this->coldData        = nullptr;
+    this->bWorldDirty     = false;
+    this->bThrottled      = false;
+    this->worldVersion    = 1;
+    this->localVersion    = 1;
+    this->childIndex      = 0;
 
     if (localMatrix) this->localMatrix = *localMatrix;
     else             D3DXMatrixIdentity(&this->localMatrix);
 
-    if (parent)
-    {
-        this->worldMatrix = this->localMatrix * parent->GetWorldMatrix();
-        this->BecomeParents(parent);
-    }
-    else
-    {
-        this->UpdateWorldMatrix();
-    }
+    this->localMatrixClass = Transform::ClassifyMatrix(localMatrix);
+
+    this->InitializeHierarchy(parent);
 }
 
 Transform::~Transform()
 {
-    //OutputDebugFormat("{} called.", __func__);
+    Transform::topologyEpoch.fetch_add(1, std::memory_order_relaxed);
+
+    // q̓[hsێ܂ܐe ( f̕ύX͐e邤ɌvZ )
+    this->DetachAllChildren(true);
+
+    // eO ( O(1) )
+    if (this->IsLinkedToParent()) this->UnlinkFromParentUnordered();
+
+    delete this->coldData.load();
 }
 
 /**************************************** eq֘A ****************************************/
@@ -57,25 +115,32 @@ Transform* Transform::GetParent() const
 
 void Transform::SetParent(Transform* const parent)
 {
-    if (parent) this->parentTransform = parent;
+    if (parent)
+    {
+        this->parentTransform = parent;
+        Transform::topologyEpoch.fetch_add(1, std::memory_order_relaxed);
+    }
     // null̎͐eq
     else        this->BreakParents();
 }
 
-const std::vector<Transform*>& Transform::GetChildren() const
+std::span<Transform* const> Transform::GetChildren() const
 {
-    return this->childrenTransforms;
+    return { this->childrenTransforms.data(), this->childrenTransforms.size() };
 }
 
 void Transform::BecomeParents(Transform* const parent)
 {
     if (parent)
     {
+        // ێ郏[hsɖf̕ύXΐɌvZ ( eq؂O )
+        this->ComputeWorldMatrixNow();
+
         if (parent->AddChild(this))
         {
             // e̕ύXɂsXV
-            this->UpdateLocalMatrix();
-            this->UpdateWorldMatrix();
+            this->PropagateLocalMatrix();
+            this->PropagateWorldMatrix();
         }
     }
     else
@@ -88,13 +153,42 @@ void Transform::BreakParents()
 {
     if (!this->parentTransform) return;
 
+    // ێ郏[hsɖf̕ύXΐɌvZ ( eq؂O )
+    this->ComputeWorldMatrixNow();
+    const bool bInherited = this->IsThrottleInherited();
+
     // ̐e
     this->parentTransform->RemoveChild(this);
 
     this->parentTransform = nullptr;
+    this->FollowParentThrottled(bInherited);
 
-    this->UpdateLocalMatrix(false);
-    this->UpdateWorldMatrix();
+    this->PropagateLocalMatrix(false);
+    this->PropagateWorldMatrix();
+}
+
+void Transform::InitializeHierarchy(Transform* const parent)
+{
+    if (parent)
+    {
+        // eqɂȂ
+        this->LinkToParent(parent);
+        this->bThrottled = parent->bThrottled;
+
+        // Ԉ̐e͍ŐVɂĂ
+        Transform::MultiplyByClass
+        (
+            &this->worldMatrix,
+            this->localMatrix,        this->localMatrixClass,
+            parent->GetWorldMatrix(), parent->worldMatrixClass
+        );
+        this->worldMatrixClass = std::max(this->localMatrixClass, parent->worldMatrixClass);
+    }
+    else
+    {
+        this->worldMatrix      = this->localMatrix;
+        this->worldMatrixClass = this->localMatrixClass;
+    }
 }
 
 bool Transform::AddChild(Transform* const child)
@@ -108,1105 +202,2753 @@ bool Transform::AddChild(Transform* const child)
     child->BreakParents();
 
     // eqɂȂ
-    child->SetParent(this);
-    this->childrenTransforms.push_back(child);
+    child->LinkToParent(this);
+
+    // Ԉ̕؂ɓqԈ
+    child->FollowParentThrottled(false);
 
     return true;
 }
 
 bool Transform::RemoveChild(Transform* const child)
 {
-    if (child && this->HasChild())
-    {
-        // erase_remove ŏ
-        this->childrenTransforms.erase
-        (
-            std::remove
-            (
-                this->childrenTransforms.begin(),
-                this->childrenTransforms.end(),
-                child
-            ),
-            this->childrenTransforms.end()
-        );
+    if (!child || child->parentTransform != this) return false;
 
-        return true;
-    }
+    // oĂʒu̎q̔zƈvĂƂO ( SetParent() ŐewĂꍇȂ )
+    if (!child->IsLinkedToParent()) return false;
 
-    return false;
+    child->UnlinkFromParent();
+    return true;
 }
 
-bool Transform::CheckAncestor(Transform* const ancestor)
+size_t Transform::DetachAllChildren(bool bKeepWorld)
 {
-    Transform* check = this;
-    do
+    if (this->childrenTransforms.empty()) return 0;
+
+    TRANSFORM_TRACE_SCOPE("Transform.DetachAllChildren");
+
+    // ێ郏[hsɖf̕ύXΐɌvZ ( eq؂O )
+    if (bKeepWorld)
     {
-        if (check == ancestor) return true;
+        for (Transform* const child : this->childrenTransforms) child->ComputeWorldMatrixNow();
+    }
 
-        check = check->GetParent();
+    // CxgŎqĂȂ悤ڂĂ ( ɎĂԂ͊mۂȂ )
+    auto children = std::move(this->childrenTransforms);
+    Transform::topologyEpoch.fetch_add(1, std::memory_order_relaxed);
+
+    for (Transform* const child : children)
+    {
+        const bool bInherited = child->bThrottled && this->bThrottled;
+
+        child->parentTransform = nullptr;
+        const bool bReleased = child->FollowParentThrottled(bInherited);
+
+        if (bKeepWorld)
+        {
+            // [hs񂪂̂܂܃[JsɂȂ ( q͕ςȂ )
+            const D3DXMATRIX before = child->localMatrix;
+
+            child->localMatrix      = child->worldMatrix;
+            child->localMatrixClass = child->worldMatrixClass;
+            if (!Transform::IsSameMatrix(before, child->localMatrix)) child->localVersion++;
+
+            // ԈOꂽA܂ĂύXqɔf
+            if (bReleased) child->UpdateDescendantsWorldMatrix();
+
+            child->EventTransformUpdated();
+        }
+        else
+        {
+            child->PropagateWorldMatrix();
+        }
     }
-    while (check);
 
-    return false;
+    return children.size();
 }
 
-bool Transform::HasParent()
+size_t Transform::DestroySubtree(Transform* const root)
 {
-    return (this->parentTransform != nullptr);
+    return Transform::DestroySubtree(root, [](Transform* node) { delete node; });
 }
 
-bool Transform::HasChild()
+void Transform::LinkToParent(Transform* const parent)
 {
-    return (this->childrenTransforms.size() != 0);
+    this->parentTransform = parent;
+    this->childIndex      = static_cast<unsigned int>(parent->childrenTransforms.size());
+    parent->childrenTransforms.push_back(this);
+
+    Transform::topologyEpoch.fetch_add(1, std::memory_order_relaxed);
 }
 
+void Transform::UnlinkFromParent()
+{
+    auto& siblings = this->parentTransform->childrenTransforms;
 
+    // ̌ZO
+    for (size_t i = this->childIndex + 1; i < siblings.size(); i++)
+    {
+        siblings[i - 1]             = siblings[i];
+        siblings[i - 1]->childIndex = static_cast<unsigned int>(i - 1);
+    }
+    siblings.pop_back();
 
-/**************************************** s ****************************************/
+    this->parentTransform = nullptr;
+    Transform::topologyEpoch.fetch_add(1, std::memory_order_relaxed);
+}
 
-const D3DXMATRIX& Transform::GetWorldMatrix() const
+void Transform::UnlinkFromParentUnordered()
 {
-    return this->worldMatrix;
+    auto& siblings = this->parentTransform->childrenTransforms;
+
+    // Ō̎q󂢂ʒuɈڂ
+    Transform* const last = siblings.back();
+    siblings[this->childIndex] = last;
+    last->childIndex           = this->childIndex;
+    siblings.pop_back();
+
+    this->parentTransform = nullptr;
+    Transform::topologyEpoch.fetch_add(1, std::memory_order_relaxed);
 }
 
-void Transform::SetWorldMatrix(const D3DXMATRIX* const worldMatrix)
+bool Transform::IsLinkedToParent() const
 {
-    if (worldMatrix) this->worldMatrix = *worldMatrix;
-    else D3DXMatrixIdentity(&this->worldMatrix);
+    const Transform* const parent = this->parentTransform;
 
-    this->UpdateLocalMatrix();
+    return parent && this->childIndex < parent->childrenTransforms.size() && parent->childrenTransforms[this->childIndex] == this;
 }
 
-const D3DXMATRIX& Transform::GetLocalMatrix() const
+void Transform::CompactChildren()
 {
-    return this->localMatrix;
+    auto& children = this->childrenTransforms;
+
+    size_t count = 0;
+    for (size_t i = 0; i < children.size(); i++)
+    {
+        if (!children[i]) continue;
+
+        children[count]             = children[i];
+        children[count]->childIndex = static_cast<unsigned int>(count);
+        count++;
+    }
+    while (children.size() > count) children.pop_back();
 }
 
-void Transform::SetLocalMatrix(const D3DXMATRIX* const localMatrix)
+bool Transform::IsThrottleInherited() const
 {
-    if (localMatrix) this->localMatrix = *localMatrix;
-    else D3DXMatrixIdentity(&this->localMatrix);
+    return this->bThrottled && this->parentTransform && this->parentTransform->bThrottled;
+}
+
+bool Transform::FollowParentThrottled(bool bInherited)
+{
+    // Ԉ̕؂ɓqԈ
+    if (this->parentTransform && this->parentTransform->bThrottled)
+    {
+        if (!this->bThrottled) this->SetUpdateThrottled(true);
+        return false;
+    }
+
+    // c󂯌pԈ͕؂o ( XPW[[ɓo^ꂽ͎g̐ݒȂ̂ł̂܂ )
+    if (!bInherited) return false;
 
-    this->UpdateWorldMatrix();
+    this->SetUpdateThrottled(false);
+    return true;
 }
 
-D3DXMATRIX Transform::GetWorldRotationMatrix() const
+void Transform::UnlinkSubtree(Transform* const root, std::vector<Transform*>* const nodes)
 {
-    D3DXMATRIX     result = {};
-    D3DXVECTOR3    dummy = {};
-    D3DXQUATERNION tempQuat = {};
+    TRANSFORM_TRACE_SCOPE("Transform.DestroySubtree");
 
-    // [hs񂩂NH[^jI𒊏o
-    D3DXMatrixDecompose(&dummy, &tempQuat, &dummy, &this->worldMatrix);
+    nodes->clear();
+    if (!root) return;
 
-    // NH[^jI]s쐬
-    D3DXMatrixRotationQuaternion(&result, &tempQuat);
+    Transform::topologyEpoch.fetch_add(1, std::memory_order_relaxed);
 
-    return result;
+    if (root->IsLinkedToParent()) root->UnlinkFromParentUnordered();
+
+    // KwɏW߂Ȃeq؂ ( fXgN^ŉ̏NȂ悤 )
+    nodes->push_back(root);
+    for (size_t i = 0; i < nodes->size(); i++)
+    {
+        Transform* const node = (*nodes)[i];
+
+        nodes->insert(nodes->end(), node->childrenTransforms.begin(), node->childrenTransforms.end());
+        node->childrenTransforms.clear();
+        node->parentTransform = nullptr;
+    }
 }
 
-D3DXMATRIX Transform::GetLocalRotationMatrix() const
+bool Transform::CheckAncestor(Transform* const ancestor)
 {
-    D3DXMATRIX     result = {};
-    D3DXVECTOR3    dummy = {};
-    D3DXQUATERNION tempQuat = {};
+    Transform* check = this;
+    do
+    {
+        if (check == ancestor) return true;
 
-    // [Js񂩂NH[^jI𒊏o
-    D3DXMatrixDecompose(&dummy, &tempQuat, &dummy, &this->localMatrix);
+        check = check->GetParent();
+    }
+    while (check);
 
-    // NH[^jI]s쐬
-    D3DXMatrixRotationQuaternion(&result, &tempQuat);
+    return false;
+}
 
-    return result;
+bool Transform::HasParent()
+{
+    return (this->parentTransform != nullptr);
 }
 
-D3DXMATRIX Transform::CreateWorldTranslationMatrix
-(
-        const D3DXVECTOR3* const location,
-        const Rotation*    const rotation,
-        const D3DXVECTOR3* const scale
-)
+bool Transform::HasChild()
 {
-    D3DXMATRIX rotationMatrix, 
-               scaleMatrix,
-               result;
+    return (this->childrenTransforms.size() != 0);
+}
 
-    D3DXMatrixIdentity(&result);
+size_t Transform::ReparentMany(std::span<Transform* const> transforms, Transform* const newParent, bool bKeepWorld)
+{
+    TRANSFORM_TRACE_SCOPE("Transform.ReparentMany");
 
-    if (scale)
+    // Ve̐c ( g܂ ) xW߂
+    std::vector<Transform*> ancestors;
+    for (Transform* check = newParent; check; check = check->parentTransform)
     {
-        D3DXMatrixScaling(&scaleMatrix, scale->x, scale->y, scale->z);
-        result *= scaleMatrix;
+        ancestors.push_back(check);
     }
+    std::sort(ancestors.begin(), ancestors.end());
+
+    // eύX Transform 𒊏o
+    std::vector<Transform*>        moved;
+    std::unordered_set<Transform*> movedSet;
 
-    if (rotation)
+    moved.reserve(transforms.size());
+    movedSet.reserve(transforms.size());
+
+    for (Transform* const transform : transforms)
     {
-        D3DXMatrixRotationYawPitchRoll(&rotationMatrix, rotation->yaw, rotation->pitch, rotation->roll);
-        result *= rotationMatrix;
+        if (!transform || transform->parentTransform == newParent) continue;
+
+        // Ve̐c͎qɂłȂ
+        if (std::binary_search(ancestors.begin(), ancestors.end(), transform)) continue;
+
+        // d
+        if (!movedSet.insert(transform).second) continue;
+
+        moved.push_back(transform);
     }
-    
-    if (location)
+
+    if (moved.empty()) return 0;
+
+    // ێ郏[hsɖf̕ύXΐɌvZ ( eq؂O )
+    std::vector<bool> inherited(moved.size());
+    for (size_t i = 0; i < moved.size(); i++)
     {
-        result._41 = location->x;
-        result._42 = location->y;
-        result._43 = location->z;
+        Transform* const transform = moved[i];
+
+        if (bKeepWorld) transform->ComputeWorldMatrixNow();
+        inherited[i] = transform->IsThrottleInherited();
     }
 
-    return result;
-}
+    // O̐eO ( 󂢂ʒu nullptr ɂĂAeƂɈxl߂ČZ̏Ԃۂ )
+    std::vector<Transform*> oldParents;
+    for (Transform* const transform : moved)
+    {
+        Transform* const oldParent = transform->parentTransform;
+        if (!oldParent) continue;
 
-D3DXMATRIX Transform::CreateWorldTranslationMatrix(const D3DXVECTOR3* const location, const D3DXMATRIX* const rotationMatrix, const D3DXVECTOR3* const scale)
-{
-    D3DXMATRIX scaleMatrix, result;
+        if (transform->IsLinkedToParent())
+        {
+            oldParent->childrenTransforms[transform->childIndex] = nullptr;
+            oldParents.push_back(oldParent);
+        }
+        transform->parentTransform = nullptr;
+    }
 
-    D3DXMatrixIdentity(&result);
+    std::sort(oldParents.begin(), oldParents.end());
+    oldParents.erase(std::unique(oldParents.begin(), oldParents.end()), oldParents.end());
+    for (Transform* const oldParent : oldParents) oldParent->CompactChildren();
+    Transform::topologyEpoch.fetch_add(1, std::memory_order_relaxed);
 
-    if (scale)
+    // Ve̋ts͈xvZ ( Ԉ̐e͍ŐVɂĂ )
+    D3DXMATRIX  parentInverse;
+    MatrixClass parentClass = MatrixClass::Identity;
+
+    if (newParent && bKeepWorld)
     {
-        D3DXMatrixScaling(&scaleMatrix, scale->x, scale->y, scale->z);
-        result *= scaleMatrix;
+        const D3DXMATRIX& parentWorld = newParent->GetWorldMatrix();
+        parentClass = newParent->worldMatrixClass;
+
+        if (parentClass != MatrixClass::Identity) Transform::InverseByClass(&parentInverse, parentWorld, parentClass);
     }
 
-    if (rotationMatrix && !D3DXMatrixIsIdentity(rotationMatrix))
+    if (newParent)
     {
-        result *= *rotationMatrix;
+        newParent->childrenTransforms.reserve(newParent->childrenTransforms.size() + moved.size());
     }
-    
-    if (location)
+
+    // eqɂȂA[Js̏
+    for (size_t i = 0; i < moved.size(); i++)
     {
-        result._41 = location->x;
-        result._42 = location->y;
-        result._43 = location->z;
-    }
+        Transform* const transform = moved[i];
 
-    return result;
-}
+        if (newParent) transform->LinkToParent(newParent);
+        const bool bReleased = transform->FollowParentThrottled(inherited[i]);
 
+        if (bKeepWorld)
+        {
+            // ԈOꂽA܂ĂύXqɔf
+            if (bReleased) transform->UpdateDescendantsWorldMatrix();
 
-/**************************************** W ****************************************/
+            const D3DXMATRIX before = transform->localMatrix;
 
-/***** world *****/
+            Transform::MultiplyByClass
+            (
+                &transform->localMatrix,
+                transform->worldMatrix, transform->worldMatrixClass,
+                parentInverse,          parentClass
+            );
+            transform->localMatrixClass = std::max(transform->worldMatrixClass, parentClass);
+            if (!Transform::IsSameMatrix(before, transform->localMatrix)) transform->localVersion++;
+        }
+    }
 
-/*** get ***/
+    // ؂ƂɈxXV
+    for (Transform* const transform : moved)
+    {
+        // [hsێꍇA؂̃[hs͕ςȂ
+        if (bKeepWorld) transform->EventTransformUpdated();
+        else            transform->PropagateWorldMatrix();
+    }
 
-D3DXVECTOR3 Transform::GetWorldLocation() const
-{
-    return D3DXVECTOR3
-    (
-        this->worldMatrix._41,
-        this->worldMatrix._42,
-        this->worldMatrix._43
-    );
+    return moved.size();
 }
 
-/*** set ***/
 
-void Transform::SetWorldLocation(const D3DXVECTOR3* const location, bool bLocalUpdate)
+
+void Transform::CollectUpdateRoots(std::span<Transform* const> transforms, std::vector<Transform*>* const roots)
 {
-    if (!location) return;
+    if (!roots) return;
 
-    this->worldMatrix._41 = location->x;
-    this->worldMatrix._42 = location->y;
-    this->worldMatrix._43 = location->z;
+    roots->clear();
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
-}
+    std::unordered_set<Transform*> touched(transforms.begin(), transforms.end());
+    std::unordered_set<Transform*> added;
 
-void Transform::SetWorldLocation(float x, float y, float z, bool bLocalUpdate)
-{
-    this->worldMatrix._41 = x;
-    this->worldMatrix._42 = y;
-    this->worldMatrix._43 = z;
+    for (Transform* const transform : transforms)
+    {
+        if (!transform) continue;
+
+        // ύXꂽ or f̐ĉԏ
+        Transform* root = transform;
+        for (Transform* parent = transform->parentTransform; parent; parent = parent->parentTransform)
+        {
+            if (parent->bWorldDirty || touched.count(parent)) root = parent;
+        }
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
+        if (added.insert(root).second) roots->push_back(root);
+    }
 }
 
-void Transform::SetWorldLocationX(float x, bool bLocalUpdate)
-{
-    this->worldMatrix._41 = x;
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
-}
 
-void Transform::SetWorldLocationY(float y, bool bLocalUpdate)
+bool Transform::BuildHierarchy
+(
+    std::span<Transform* const> transforms,
+    std::span<const int>        parentIndices,
+    std::span<const D3DXMATRIX> localMatrices
+)
 {
-    this->worldMatrix._42 = y;
-
-    if(bLocalUpdate) this->UpdateLocalMatrix();
+    return Transform::BuildHierarchyImpl(transforms, parentIndices, localMatrices, {});
 }
 
-void Transform::SetWorldLocationZ(float z, bool bLocalUpdate)
+bool Transform::BuildHierarchy
+(
+    std::span<Transform* const>  transforms,
+    std::span<const int>         parentIndices,
+    std::span<const D3DXVECTOR3> locations,
+    std::span<const Rotation>    rotations,
+    std::span<const D3DXVECTOR3> scales
+)
 {
-    this->worldMatrix._43 = z;
-
-    if(bLocalUpdate) this->UpdateLocalMatrix();
-}
+    const size_t count = transforms.size();
+    if (locations.size() != count || rotations.size() != count || scales.size() != count)
+    {
+        OutputDebugFormat("Transform.BuildHierarchy : array sizes do not match.\n");
+        return false;
+    }
 
-/*** add ***/
+    // sƕނ ( ނ̓RXgN^Ɠ )
+    std::vector<D3DXMATRIX>  matrices(count);
+    std::vector<MatrixClass> classes(count);
 
-void Transform::AddWorldLocation(const D3DXVECTOR3* const location, bool bLocalUpdate)
-{
-    this->worldMatrix._41 += location->x;
-    this->worldMatrix._42 += location->y;
-    this->worldMatrix._43 += location->z;
+    for (size_t i = 0; i < count; i++)
+    {
+        matrices[i] = Transform::CreateWorldTranslationMatrix(&locations[i], &rotations[i], &scales[i]);
+        classes[i]  = Transform::ScaledClass(MatrixClass::Rigid, &scales[i]);
+    }
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
+    return Transform::BuildHierarchyImpl(transforms, parentIndices, matrices, classes);
 }
 
-void Transform::AddWorldLocation(float x, float y, float z, bool bLocalUpdate)
+bool Transform::BuildHierarchyImpl
+(
+    std::span<Transform* const>  transforms,
+    std::span<const int>         parentIndices,
+    std::span<const D3DXMATRIX>  localMatrices,
+    std::span<const MatrixClass> classes
+)
 {
-    this->worldMatrix._41 += x;
-    this->worldMatrix._42 += y;
-    this->worldMatrix._43 += z;
+    TRANSFORM_TRACE_SCOPE("Transform.BuildHierarchy");
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
-}
+    const size_t count = transforms.size();
+    if (parentIndices.size() != count || localMatrices.size() != count)
+    {
+        OutputDebugFormat("Transform.BuildHierarchy : array sizes do not match.\n");
+        return false;
+    }
 
-/***** local *****/
+    // dAe̔ԍ͈̔
+    std::unordered_map<Transform*, size_t> nodeIndices;
+    nodeIndices.reserve(count);
 
-/*** get ***/
+    for (size_t i = 0; i < count; i++)
+    {
+        const int parentIndex = parentIndices[i];
 
-D3DXVECTOR3 Transform::GetLocalLocation() const
-{
-    return D3DXVECTOR3
-    (
+        if (!transforms[i] || !nodeIndices.emplace(transforms[i], i).second)
+        {
+            OutputDebugFormat("Transform.BuildHierarchy : null or duplicated transform.\n");
+            return false;
+        }
+        if (parentIndex < -1 || parentIndex >= static_cast<int>(count) || parentIndex == static_cast<int>(i))
+        {
+            OutputDebugFormat("Transform.BuildHierarchy : parent index out of range.\n");
+            return false;
+        }
+        if (parentIndex >= 0 && transforms[i]->parentTransform)
+        {
+            OutputDebugFormat("Transform.BuildHierarchy : transform already has a parent.\n");
+            return false;
+        }
+    }
+
+    // ɌvZm[h ( e̔ԍA-1 Ȃ獡̐eHčŏɌgݗĂm[h )
+    std::vector<int> dependIndices(parentIndices.begin(), parentIndices.end());
+    for (size_t i = 0; i < count; i++)
+    {
+        if (parentIndices[i] >= 0) continue;
+
+        for (Transform* check = transforms[i]->parentTransform; check; check = check->parentTransform)
+        {
+            const auto found = nodeIndices.find(check);
+            if (found == nodeIndices.end()) continue;
+
+            dependIndices[i] = static_cast<int>(found->second);
+            break;
+        }
+    }
+
+    // q̐𐔂āAq̔ԍeƂɋl߂ ( v\[gA̐ẻɂm[h܂ )
+    std::vector<size_t> childBegin(count + 1, 0);
+    for (size_t i = 0; i < count; i++)
+    {
+        if (dependIndices[i] >= 0) childBegin[dependIndices[i] + 1]++;
+    }
+    for (size_t i = 0; i < count; i++) childBegin[i + 1] += childBegin[i];
+
+    std::vector<size_t> childIndices(childBegin[count]);
+    {
+        std::vector<size_t> cursor(childBegin.begin(), childBegin.end() - 1);
+        for (size_t i = 0; i < count; i++)
+        {
+            if (dependIndices[i] >= 0) childIndices[cursor[dependIndices[i]]++] = i;
+        }
+    }
+
+    // Kwɕׂ ( HȂm[hΏzĂ )
+    std::vector<size_t> order;
+    order.reserve(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (dependIndices[i] < 0) order.push_back(i);
+    }
+
+    for (size_t head = 0; head < order.size(); head++)
+    {
+        const size_t node = order[head];
+        order.insert(order.end(), childIndices.begin() + childBegin[node], childIndices.begin() + childBegin[node + 1]);
+    }
+
+    if (order.size() != count)
+    {
+        OutputDebugFormat("Transform.BuildHierarchy : hierarchy has a cycle.\n");
+        return false;
+    }
+
+    // gݗĂm[h̉ɂÕm[heɎm[hƁA̎q ( Kw̌vZ͏ )
+    // O̐ě͉Xq̍XV܂ŌÂ̂ŁA̍XVŕ؂ƈxvZ ( vZŃCxgxNȂ悤 )
+    std::vector<bool> deferred(count, false);
+    for (const size_t i : order)
+    {
+        if (dependIndices[i] < 0) continue;
+
+        const bool bOutsideParent = parentIndices[i] < 0 && transforms[i]->parentTransform != transforms[dependIndices[i]];
+        deferred[i] = bOutsideParent || deferred[dependIndices[i]];
+    }
+
+    // Xq ( gݗĂɎqXVAgݗĂm[h͊KwɌvẐŏ )
+    // m[h̎q́ǍXq̍XVňꏏɌvẐŏW߂Ȃ
+    std::vector<Transform*> existingChildren;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (deferred[i]) continue;
+
+        for (Transform* const child : transforms[i]->childrenTransforms)
+        {
+            if (!nodeIndices.count(child)) existingChildren.push_back(child);
+        }
+    }
+
+    // eqɂȂ ( q̔z͐Ɋm )
+    for (size_t i = 0; i < count; i++)
+    {
+        size_t childCount = 0;
+        for (size_t c = childBegin[i]; c < childBegin[i + 1]; c++)
+        {
+            if (parentIndices[childIndices[c]] >= 0) childCount++;
+        }
+        if (childCount == 0) continue;
+
+        Transform* const parent = transforms[i];
+        parent->childrenTransforms.reserve(parent->childrenTransforms.size() + childCount);
+
+        for (size_t c = childBegin[i]; c < childBegin[i + 1]; c++)
+        {
+            if (parentIndices[childIndices[c]] >= 0) transforms[childIndices[c]]->LinkToParent(parent);
+        }
+    }
+
+    // KwɃ[JsZbgă[hsvZ ( e͕KqAm[h̓[Js񂾂 )
+    for (const size_t i : order)
+    {
+        Transform* const node = transforms[i];
+
+        // O̐e͊ԈȂ̂ōŐVɂĂ
+        if (!deferred[i] && parentIndices[i] < 0 && node->parentTransform) node->parentTransform->GetWorldMatrix();
+        if (node->parentTransform && node->parentTransform->bThrottled) node->bThrottled = true;
+
+        const D3DXMATRIX before = node->localMatrix;
+        node->localMatrix      = localMatrices[i];
+        node->localMatrixClass = classes.empty() ? Transform::ClassifyMatrix(&localMatrices[i]) : classes[i];
+        if (!Transform::IsSameMatrix(before, node->localMatrix)) node->localVersion++;
+
+        if (!deferred[i]) node->CalcWorldMatrix();
+    }
+
+    // XqXV ( m[hŌvZACxg )
+    for (Transform* const child : existingChildren)
+    {
+        child->PropagateWorldMatrix();
+    }
+
+    // Cxg ( [Aq͐e )
+    for (size_t i = order.size(); i-- > 0;)
+    {
+        if (!deferred[order[i]]) transforms[order[i]]->EventTransformUpdated();
+    }
+
+    return true;
+}
+
+void Transform::SwapNodes(Transform* const a, Transform* const b)
+{
+    if (a == b) return;
+
+    // m[h̒gʂ̈ʒuɈڂ̂ŁAʒuŊo GetRelativeMatrix() ̃LbV̂Ă
+    Transform::topologyEpoch.fetch_add(1, std::memory_order_relaxed);
+
+    // g
+    std::swap(a->worldMatrix,        b->worldMatrix);
+    std::swap(a->localMatrix,        b->localMatrix);
+    std::swap(a->worldMatrixClass,   b->worldMatrixClass);
+    std::swap(a->localMatrixClass,   b->localMatrixClass);
+    std::swap(a->bWorldDirty,        b->bWorldDirty);
+    std::swap(a->bThrottled,         b->bThrottled);
+    std::swap(a->worldVersion,       b->worldVersion);
+    std::swap(a->localVersion,       b->localVersion);
+    std::swap(a->childIndex,         b->childIndex);
+    std::swap(a->parentTransform,    b->parentTransform);
+    std::swap(a->childrenTransforms, b->childrenTransforms);
+    a->coldData.store(b->coldData.exchange(a->coldData.load()));
+
+    // Âʒuw|C^Vʒu
+    auto remap = [a, b](Transform* node) { return (node == a) ? b : (node == b) ? a : node; };
+
+    for (Transform* const node : { a, b })
+    {
+        node->parentTransform = remap(node->parentTransform);
+        for (auto&& child : node->childrenTransforms) child = remap(child);
+    }
+
+    // e̎qXg ( a, b g͏ŕtւς݁AeȂx )
+    Transform* const parentA = a->parentTransform;
+    Transform* const parentB = b->parentTransform;
+
+    for (Transform* const parent : { parentA, parentB })
+    {
+        if (!parent || parent == a || parent == b) continue;
+
+        for (auto&& child : parent->childrenTransforms) child = remap(child);
+
+        if (parentA == parentB) break;
+    }
+
+    // q̐e|C^
+    for (Transform* const node : { a, b })
+    {
+        for (auto&& child : node->childrenTransforms)
+        {
+            if (child != a && child != b) child->parentTransform = node;
+        }
+    }
+}
+
+
+
+/**************************************** s ****************************************/
+
+const D3DXMATRIX& Transform::GetWorldMatrix() const
+{
+    this->RefreshWorldMatrix();
+
+    return this->worldMatrix;
+}
+
+void Transform::RefreshWorldMatrix() const
+{
+    // Ԉ͓ǂ܂ꂽƂɌvZ ( LbV̍XVȂ̂ const O )
+    if (this->bThrottled) const_cast<Transform*>(this)->ComputeWorldMatrixNow();
+}
+
+const D3DXMATRIX& Transform::ComputeWorldMatrixNow()
+{
+    TRANSFORM_TRACE_SCOPE("Transform.ComputeWorldMatrixNow");
+
+    // ԏ̖XV̐cT
+    Transform* top = nullptr;
+    for (Transform* check = this; check; check = check->parentTransform)
+    {
+        if (check->bWorldDirty) top = check;
+    }
+
+    // cɖf̕ύX͖
+    if (!top) return this->worldMatrix;
+
+    // top 玩g܂ł̌oH ( g )
+    thread_local std::vector<Transform*> path;
+    path.clear();
+
+    for (Transform* node = this; node != top; node = node->parentTransform)
+    {
+        path.push_back(node);
+    }
+    path.push_back(top);
+
+    // ォ珇ɌoHvZ
+    for (size_t i = path.size(); i-- > 0;)
+    {
+        Transform* const node = path[i];
+        Transform* const next = (i > 0) ? path[i - 1] : nullptr;
+
+        node->CalcWorldMatrix();
+        node->bWorldDirty = false;
+
+        // oHO̎q͖vẐ܂܈t
+        for (auto&& child : node->childrenTransforms)
+        {
+            if (child != next) child->bWorldDirty = true;
+        }
+    }
+
+    return this->worldMatrix;
+}
+
+bool Transform::IsWorldMatrixDirty() const
+{
+    return this->bWorldDirty;
+}
+
+unsigned int Transform::GetWorldVersion() const
+{
+    this->RefreshWorldMatrix();
+
+    return this->worldVersion;
+}
+
+unsigned int Transform::GetLocalVersion() const
+{
+    return this->localVersion;
+}
+
+void Transform::AdvanceFrameEpoch()
+{
+    Transform::frameEpoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+unsigned int Transform::GetFrameEpoch()
+{
+    return Transform::frameEpoch.load(std::memory_order_relaxed);
+}
+
+unsigned int Transform::GetWorldChangeCount()
+{
+    return Transform::worldChangeCount.load(std::memory_order_relaxed);
+}
+
+const D3DXMATRIX& Transform::GetInverseWorldMatrix() const
+{
+    this->RefreshWorldMatrix();
+
+    ColdData& cold = this->GetColdData();
+
+    if (cold.inverseWorldVersion.load(std::memory_order_acquire) != this->worldVersion)
+    {
+        std::lock_guard<std::mutex> lock(cold.fillMutex);
+
+        if (cold.inverseWorldVersion.load(std::memory_order_relaxed) != this->worldVersion)
+        {
+            Transform::InverseByClass(&cold.inverseWorldMatrix, this->worldMatrix, this->worldMatrixClass);
+            cold.inverseWorldVersion.store(this->worldVersion, std::memory_order_release);
+        }
+    }
+
+    return cold.inverseWorldMatrix;
+}
+
+const D3DXMATRIX& Transform::GetNormalMatrix() const
+{
+    this->RefreshWorldMatrix();
+
+    ColdData& cold = this->GetColdData();
+
+    if (cold.normalVersion.load(std::memory_order_acquire) == this->worldVersion) return cold.normalMatrix;
+
+    // ʂ̍s͋tsg ( ts̃LbVr̂ŁAO )
+    const bool bGeneral = this->worldMatrixClass > MatrixClass::UniformScale;
+    const D3DXMATRIX* const inverse = bGeneral ? &this->GetInverseWorldMatrix() : nullptr;
+
+    std::lock_guard<std::mutex> lock(cold.fillMutex);
+    if (cold.normalVersion.load(std::memory_order_relaxed) == this->worldVersion) return cold.normalMatrix;
+
+    D3DXMATRIX& result = cold.normalMatrix;
+
+    switch (this->worldMatrixClass)
+    {
+    case MatrixClass::Identity:
+    case MatrixClass::Translation:
+        // @͕ςȂ
+        D3DXMatrixIdentity(&result);
+        break;
+
+    case MatrixClass::Rigid:
+    case MatrixClass::UniformScale:
+    {
+        // ]̋t]u͉]̂ ( ψgkȂ 1 / s^2 { )
+        const D3DXMATRIX& world = this->worldMatrix;
+        const float scaleSq = (this->worldMatrixClass == MatrixClass::Rigid)
+            ? 1.0f
+            : world._11 * world._11 + world._12 * world._12 + world._13 * world._13;
+
+        // gk 0 ͋ts񂪖̂ŒPʍs
+        if (scaleSq == 0.0f)
+        {
+            D3DXMatrixIdentity(&result);
+            break;
+        }
+
+        const float invScaleSq = 1.0f / scaleSq;
+
+        result._11 = world._11 * invScaleSq; result._12 = world._12 * invScaleSq; result._13 = world._13 * invScaleSq; result._14 = 0.0f;
+        result._21 = world._21 * invScaleSq; result._22 = world._22 * invScaleSq; result._23 = world._23 * invScaleSq; result._24 = 0.0f;
+        result._31 = world._31 * invScaleSq; result._32 = world._32 * invScaleSq; result._33 = world._33 * invScaleSq; result._34 = 0.0f;
+        result._41 = 0.0f;                   result._42 = 0.0f;                   result._43 = 0.0f;                   result._44 = 1.0f;
+        break;
+    }
+
+    default:
+    {
+        // ts ( LbV )  3x3 ]u
+        result._11 = inverse->_11; result._12 = inverse->_21; result._13 = inverse->_31; result._14 = 0.0f;
+        result._21 = inverse->_12; result._22 = inverse->_22; result._23 = inverse->_32; result._24 = 0.0f;
+        result._31 = inverse->_13; result._32 = inverse->_23; result._33 = inverse->_33; result._34 = 0.0f;
+        result._41 = 0.0f;        result._42 = 0.0f;        result._43 = 0.0f;        result._44 = 1.0f;
+        break;
+    }
+    }
+
+    cold.normalVersion.store(this->worldVersion, std::memory_order_release);
+
+    return result;
+}
+
+D3DXMATRIX Transform::GetRelativeMatrix(const Transform* const from, const Transform* const to, RelativeMatrixCache* const cache)
+{
+    size_t fromDepth = 0;
+    size_t toDepth   = 0;
+
+    for (const Transform* node = from; node; node = node->parentTransform) fromDepth++;
+    for (const Transform* node = to;   node; node = node->parentTransform) toDepth++;
+
+    // ʂ̐cT ( [𑵂Ăꏏɏ )Aʂm[h̃[Js̔ł𑫂Ă
+    unsigned int pathVersion = 0;
+
+    const Transform* a = from;
+    const Transform* b = to;
+    for (; fromDepth > toDepth; fromDepth--) { pathVersion += a->localVersion; a = a->parentTransform; }
+    for (; toDepth > fromDepth; toDepth--)   { pathVersion += b->localVersion; b = b->parentTransform; }
+    while (a != b)
+    {
+        pathVersion += a->localVersion + b->localVersion;
+        a = a->parentTransform;
+        b = b->parentTransform;
+    }
+    const Transform* const ancestor = a;
+
+    const unsigned int epoch = Transform::topologyEpoch.load(std::memory_order_relaxed);
+
+    // ł͑邾Ȃ̂ŁAeqςĂȂ ( oHȂ ) aԂ͌oH̃[Js
+    if
+    (
+        cache                                               &&
+        cache->bValid                                       &&
+        cache->from          == from                        &&
+        cache->to            == to                          &&
+        cache->pathVersion   == pathVersion                 &&
+        cache->topologyEpoch == epoch
+    )
+    {
+        return cache->matrix;
+    }
+
+    // from 狤ʂ̐c̎O܂ : from.local * parent.local * ...
+    D3DXMATRIX  fromPath;
+    MatrixClass fromClass = MatrixClass::Identity;
+    D3DXMatrixIdentity(&fromPath);
+
+    for (const Transform* node = from; node != ancestor; node = node->parentTransform)
+    {
+        D3DXMATRIX product;
+        Transform::MultiplyByClass(&product, fromPath, fromClass, node->localMatrix, node->localMatrixClass);
+        fromPath  = product;
+        fromClass = std::max(fromClass, node->localMatrixClass);
+    }
+
+    // to 狤ʂ̐c̎O܂ł̋t : ... * inverse(parent.local) * inverse(to.local)
+    D3DXMATRIX  toInverse;
+    MatrixClass toClass = MatrixClass::Identity;
+    D3DXMatrixIdentity(&toInverse);
+
+    for (const Transform* node = to; node != ancestor; node = node->parentTransform)
+    {
+        if (node->localMatrixClass == MatrixClass::Identity) continue;
+
+        D3DXMATRIX inverse, product;
+        Transform::InverseByClass(&inverse, node->localMatrix, node->localMatrixClass);
+        Transform::MultiplyByClass(&product, inverse, node->localMatrixClass, toInverse, toClass);
+        toInverse = product;
+        toClass   = std::max(toClass, node->localMatrixClass);
+    }
+
+    D3DXMATRIX result;
+    Transform::MultiplyByClass(&result, fromPath, fromClass, toInverse, toClass);
+
+    if (cache)
+    {
+        cache->matrix        = result;
+        cache->from          = from;
+        cache->to            = to;
+        cache->pathVersion   = pathVersion;
+        cache->topologyEpoch = epoch;
+        cache->bValid        = true;
+    }
+
+    return result;
+}
+
+void Transform::SetWorldMatrix(const D3DXMATRIX* const worldMatrix)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    if (worldMatrix) this->worldMatrix = *worldMatrix;
+    else D3DXMatrixIdentity(&this->worldMatrix);
+
+    this->WorldMatrixChanged(before, Transform::ClassifyMatrix(worldMatrix), true);
+}
+
+const D3DXMATRIX& Transform::GetLocalMatrix() const
+{
+    return this->localMatrix;
+}
+
+void Transform::SetLocalMatrix(const D3DXMATRIX* const localMatrix)
+{
+    const D3DXMATRIX before = this->localMatrix;
+
+    if (localMatrix) this->localMatrix = *localMatrix;
+    else D3DXMatrixIdentity(&this->localMatrix);
+
+    this->LocalMatrixChanged(before, Transform::ClassifyMatrix(localMatrix), true);
+}
+
+Transform::MatrixClass Transform::GetWorldMatrixClass() const
+{
+    this->RefreshWorldMatrix();
+
+    return this->worldMatrixClass;
+}
+
+Transform::MatrixClass Transform::GetLocalMatrixClass() const
+{
+    return this->localMatrixClass;
+}
+
+Transform::MatrixClass Transform::ClassifyMatrix(const D3DXMATRIX* const matrix)
+{
+    if (!matrix) return MatrixClass::Identity;
+
+    const D3DXMATRIX& m = *matrix;
+
+    // ˉeΈ
+    if (m._14 != 0.0f || m._24 != 0.0f || m._34 != 0.0f || m._44 != 1.0f) return MatrixClass::General;
+
+    const bool bTranslation = (m._41 != 0.0f || m._42 != 0.0f || m._43 != 0.0f);
+
+    if (m._11 == 1.0f && m._12 == 0.0f && m._13 == 0.0f &&
+        m._21 == 0.0f && m._22 == 1.0f && m._23 == 0.0f &&
+        m._31 == 0.0f && m._32 == 0.0f && m._33 == 1.0f)
+    {
+        return bTranslation ? MatrixClass::Translation : MatrixClass::Identity;
+    }
+
+    // eĂȂΈ
+    const float epsilon = 1.0e-4f;
+    const D3DXVECTOR3 axes[3] =
+    {
+        {m._11, m._12, m._13},
+        {m._21, m._22, m._23},
+        {m._31, m._32, m._33}
+    };
+    const float lengthSq[3] =
+    {
+        D3DXVec3Dot(&axes[0], &axes[0]),
+        D3DXVec3Dot(&axes[1], &axes[1]),
+        D3DXVec3Dot(&axes[2], &axes[2])
+    };
+
+    if (fabsf(D3DXVec3Dot(&axes[0], &axes[1])) > epsilon * lengthSq[0] ||
+        fabsf(D3DXVec3Dot(&axes[1], &axes[2])) > epsilon * lengthSq[1] ||
+        fabsf(D3DXVec3Dot(&axes[2], &axes[0])) > epsilon * lengthSq[2])
+    {
+        return MatrixClass::General;
+    }
+
+    // ̒ĂȂΈ
+    if (fabsf(lengthSq[0] - lengthSq[1]) > epsilon * lengthSq[0] ||
+        fabsf(lengthSq[0] - lengthSq[2]) > epsilon * lengthSq[0])
+    {
+        return MatrixClass::General;
+    }
+
+    return (fabsf(lengthSq[0] - 1.0f) > epsilon) ? MatrixClass::UniformScale : MatrixClass::Rigid;
+}
+
+D3DXMATRIX Transform::GetWorldRotationMatrix() const
+{
+    this->RefreshWorldMatrix();
+
+    D3DXMATRIX     result = {};
+    D3DXVECTOR3    dummy = {};
+    D3DXQUATERNION tempQuat = {};
+
+    // [hs񂩂NH[^jI𒊏o
+    D3DXMatrixDecompose(&dummy, &tempQuat, &dummy, &this->worldMatrix);
+
+    // f܂ލsłKȉ]sɂȂ悤K ( ނ Rigid ɕۂ )
+    D3DXQuaternionNormalize(&tempQuat, &tempQuat);
+
+    // NH[^jI]s쐬
+    D3DXMatrixRotationQuaternion(&result, &tempQuat);
+
+    return result;
+}
+
+D3DXMATRIX Transform::GetLocalRotationMatrix() const
+{
+    D3DXMATRIX     result = {};
+    D3DXVECTOR3    dummy = {};
+    D3DXQUATERNION tempQuat = {};
+
+    // [Js񂩂NH[^jI𒊏o
+    D3DXMatrixDecompose(&dummy, &tempQuat, &dummy, &this->localMatrix);
+
+    // f܂ލsłKȉ]sɂȂ悤K ( ނ Rigid ɕۂ )
+    D3DXQuaternionNormalize(&tempQuat, &tempQuat);
+
+    // NH[^jI]s쐬
+    D3DXMatrixRotationQuaternion(&result, &tempQuat);
+
+    return result;
+}
+
+D3DXMATRIX Transform::CreateWorldTranslationMatrix
+(
+        const D3DXVECTOR3* const location,
+        const Rotation*    const rotation,
+        const D3DXVECTOR3* const scale
+)
+{
+    D3DXMATRIX result;
+
+    if (rotation) D3DXMatrixRotationYawPitchRoll(&result, rotation->yaw, rotation->pitch, rotation->roll);
+    else          D3DXMatrixIdentity(&result);
+
+    // XP[sƂ̊|Z̑Ɋegk
+    if (scale)
+    {
+        result._11 *= scale->x; result._12 *= scale->x; result._13 *= scale->x;
+        result._21 *= scale->y; result._22 *= scale->y; result._23 *= scale->y;
+        result._31 *= scale->z; result._32 *= scale->z; result._33 *= scale->z;
+    }
+    
+    if (location)
+    {
+        result._41 = location->x;
+        result._42 = location->y;
+        result._43 = location->z;
+    }
+
+    return result;
+}
+
+D3DXMATRIX Transform::CreateWorldTranslationMatrix(const D3DXVECTOR3* const location, const D3DXMATRIX* const rotationMatrix, const D3DXVECTOR3* const scale)
+{
+    D3DXMATRIX result;
+
+    if (rotationMatrix) result = *rotationMatrix;
+    else                D3DXMatrixIdentity(&result);
+
+    // XP[sƂ̊|Z̑Ɋegk
+    if (scale)
+    {
+        result._11 *= scale->x; result._12 *= scale->x; result._13 *= scale->x;
+        result._21 *= scale->y; result._22 *= scale->y; result._23 *= scale->y;
+        result._31 *= scale->z; result._32 *= scale->z; result._33 *= scale->z;
+    }
+    
+    if (location)
+    {
+        result._41 = location->x;
+        result._42 = location->y;
+        result._43 = location->z;
+    }
+
+    return result;
+}
+
+
+/**************************************** W ****************************************/
+
+/***** world *****/
+
+/*** get ***/
+
+D3DXVECTOR3 Transform::GetWorldLocation() const
+{
+    this->RefreshWorldMatrix();
+
+    return D3DXVECTOR3
+    (
+        this->worldMatrix._41,
+        this->worldMatrix._42,
+        this->worldMatrix._43
+    );
+}
+
+/*** set ***/
+
+void Transform::SetWorldLocation(const D3DXVECTOR3* const location, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    if (!location) return;
+
+    this->worldMatrix._41 = location->x;
+    this->worldMatrix._42 = location->y;
+    this->worldMatrix._43 = location->z;
+
+    this->WorldMatrixChanged(before, std::max(this->worldMatrixClass, MatrixClass::Translation), bLocalUpdate);
+}
+
+void Transform::SetWorldLocation(float x, float y, float z, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    this->worldMatrix._41 = x;
+    this->worldMatrix._42 = y;
+    this->worldMatrix._43 = z;
+
+    this->WorldMatrixChanged(before, std::max(this->worldMatrixClass, MatrixClass::Translation), bLocalUpdate);
+}
+
+void Transform::SetWorldLocationX(float x, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    this->worldMatrix._41 = x;
+
+    this->WorldMatrixChanged(before, std::max(this->worldMatrixClass, MatrixClass::Translation), bLocalUpdate);
+}
+
+void Transform::SetWorldLocationY(float y, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    this->worldMatrix._42 = y;
+
+    this->WorldMatrixChanged(before, std::max(this->worldMatrixClass, MatrixClass::Translation), bLocalUpdate);
+}
+
+void Transform::SetWorldLocationZ(float z, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    this->worldMatrix._43 = z;
+
+    this->WorldMatrixChanged(before, std::max(this->worldMatrixClass, MatrixClass::Translation), bLocalUpdate);
+}
+
+/*** add ***/
+
+void Transform::AddWorldLocation(const D3DXVECTOR3* const location, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    this->worldMatrix._41 += location->x;
+    this->worldMatrix._42 += location->y;
+    this->worldMatrix._43 += location->z;
+
+    this->WorldMatrixChanged(before, std::max(this->worldMatrixClass, MatrixClass::Translation), bLocalUpdate);
+}
+
+void Transform::AddWorldLocation(float x, float y, float z, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    this->worldMatrix._41 += x;
+    this->worldMatrix._42 += y;
+    this->worldMatrix._43 += z;
+
+    this->WorldMatrixChanged(before, std::max(this->worldMatrixClass, MatrixClass::Translation), bLocalUpdate);
+}
+
+/***** local *****/
+
+/*** get ***/
+
+D3DXVECTOR3 Transform::GetLocalLocation() const
+{
+    return D3DXVECTOR3
+    (
         this->localMatrix._41,
         this->localMatrix._42,
         this->localMatrix._43
     );
 }
 
-/*** set ***/
+/*** set ***/
+
+void Transform::SetLocalLocation(const D3DXVECTOR3* const location, bool bWorldUpdate)
+{
+    const D3DXMATRIX before = this->localMatrix;
+
+    this->localMatrix._41 = location->x;
+    this->localMatrix._42 = location->y;
+    this->localMatrix._43 = location->z;
+
+    this->LocalMatrixChanged(before, std::max(this->localMatrixClass, MatrixClass::Translation), bWorldUpdate);
+}
+
+void Transform::SetLocalLocation(float x, float y, float z, bool bWorldUpdate)
+{
+    const D3DXMATRIX before = this->localMatrix;
+
+    this->localMatrix._41 = x;
+    this->localMatrix._42 = y;
+    this->localMatrix._43 = z;
+
+    this->LocalMatrixChanged(before, std::max(this->localMatrixClass, MatrixClass::Translation), bWorldUpdate);
+}
+
+void Transform::SetLocalLocationX(float x, bool bWorldUpdate)
+{
+    const D3DXMATRIX before = this->localMatrix;
+
+    this->localMatrix._41 = x;
+
+    this->LocalMatrixChanged(before, std::max(this->localMatrixClass, MatrixClass::Translation), bWorldUpdate);
+}
+
+void Transform::SetLocalLocationY(float y, bool bWorldUpdate)
+{
+    const D3DXMATRIX before = this->localMatrix;
+
+    this->localMatrix._42 = y;
+
+    this->LocalMatrixChanged(before, std::max(this->localMatrixClass, MatrixClass::Translation), bWorldUpdate);
+}
+
+void Transform::SetLocalLocationZ(float z, bool bWorldUpdate)
+{
+    const D3DXMATRIX before = this->localMatrix;
+
+    this->localMatrix._43 = z;
+
+    this->LocalMatrixChanged(before, std::max(this->localMatrixClass, MatrixClass::Translation), bWorldUpdate);
+}
+
+/*** add ***/
+
+void Transform::AddLocalLocation(const D3DXVECTOR3* const location, bool bWorldUpdate)
+{
+    const D3DXMATRIX before = this->localMatrix;
+
+    this->localMatrix._41 += location->x;
+    this->localMatrix._42 += location->y;
+    this->localMatrix._43 += location->z;
+
+    this->LocalMatrixChanged(before, std::max(this->localMatrixClass, MatrixClass::Translation), bWorldUpdate);
+}
+
+void Transform::AddLocalLocation(float x, float y, float z, bool bWorldUpdate)
+{
+    const D3DXMATRIX before = this->localMatrix;
+
+    this->localMatrix._41 += x;
+    this->localMatrix._42 += y;
+    this->localMatrix._43 += z;
+
+    this->LocalMatrixChanged(before, std::max(this->localMatrixClass, MatrixClass::Translation), bWorldUpdate);
+}
+
+
+
+/**************************************** ] ****************************************/
+
+/***** world *****/
+
+/*** get ***/
+
+Rotation Transform::GetWorldRotation() const
+{
+    this->RefreshWorldMatrix();
+
+    D3DXVECTOR3    dummy = {};
+    D3DXQUATERNION tempQuat = {};
+    D3DXMatrixDecompose(&dummy, &tempQuat, &dummy, &this->worldMatrix);
+    return Rotation::QuatToRotation(&tempQuat);
+}
+
+D3DXQUATERNION Transform::GetWorldQuaternion() const
+{
+    D3DXQUATERNION result;
+    D3DXMATRIX     rotationMatrix = this->GetWorldRotationMatrix();
+
+    D3DXQuaternionRotationMatrix(&result, &rotationMatrix);
+
+    return result;
+}
+
+/*** set ***/
+
+void Transform::SetWorldRotation(const Rotation* const rotation, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    if (!rotation) return;
+
+    D3DXVECTOR3 tempLocation = this->GetWorldLocation(),
+        tempScale    = this->GetWorldScale();
+
+    this->worldMatrix 
+        = this->CreateWorldTranslationMatrix(&tempLocation, rotation, &tempScale); 
+
+    this->WorldMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(&tempScale)), bLocalUpdate);
+}
+
+void Transform::SetWorldRotation(float yaw, float pitch, float roll, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    D3DXVECTOR3 tempLocation = this->GetWorldLocation();
+    D3DXVECTOR3 tempScale    = this->GetWorldScale();
+    Rotation    tempRotation(yaw, pitch, roll);
+
+    this->worldMatrix 
+        = this->CreateWorldTranslationMatrix(&tempLocation, &tempRotation, &tempScale);
+
+    this->WorldMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(&tempScale)), bLocalUpdate);
+}
+
+/*** add ***/
+
+void Transform::AddWorldRotation(const Rotation* const rotation, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    if (!rotation) return;
+
+    // NH[^jIŐς ( ꂪȂ )
+    if (bLocalUpdate && this->IsQuaternionRotationMode())
+    {
+        D3DXQUATERNION delta;
+        D3DXQuaternionRotationYawPitchRoll(&delta, rotation->yaw, rotation->pitch, rotation->roll);
+        if (this->WorldToLocalRotationDelta(&delta))
+        {
+            this->AccumulateLocalQuaternion(delta, true);
+            return;
+        }
+    }
+
+    D3DXVECTOR3 tempLocation = this->GetWorldLocation();
+    D3DXMATRIX  rotationMatrix;
+
+    D3DXMatrixRotationYawPitchRoll(&rotationMatrix, rotation->yaw, rotation->pitch, rotation->roll);
+
+    this->worldMatrix._41 = 0.0f;
+    this->worldMatrix._42 = 0.0f;
+    this->worldMatrix._43 = 0.0f;
+
+    this->worldMatrix *= rotationMatrix;
+
+    this->worldMatrix._41 = tempLocation.x;
+    this->worldMatrix._42 = tempLocation.y;
+    this->worldMatrix._43 = tempLocation.z;
+
+    this->WorldMatrixChanged(before, std::max(this->worldMatrixClass, MatrixClass::Rigid), bLocalUpdate);
+}
+
+void Transform::AddWorldRotation(float yaw, float pitch, float roll, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    // NH[^jIŐς ( ꂪȂ )
+    if (bLocalUpdate && this->IsQuaternionRotationMode())
+    {
+        D3DXQUATERNION delta;
+        D3DXQuaternionRotationYawPitchRoll(&delta, yaw, pitch, roll);
+        if (this->WorldToLocalRotationDelta(&delta))
+        {
+            this->AccumulateLocalQuaternion(delta, true);
+            return;
+        }
+    }
+
+    D3DXVECTOR3 tempLocation = this->GetWorldLocation();
+    D3DXMATRIX  rotationMatrix;
+
+    D3DXMatrixRotationYawPitchRoll(&rotationMatrix, yaw, pitch, roll);
+
+    this->worldMatrix._41 = 0.0f;
+    this->worldMatrix._42 = 0.0f;
+    this->worldMatrix._43 = 0.0f;
+
+    this->worldMatrix *= rotationMatrix;
+
+    this->worldMatrix._41 = tempLocation.x;
+    this->worldMatrix._42 = tempLocation.y;
+    this->worldMatrix._43 = tempLocation.z;
+
+    this->WorldMatrixChanged(before, std::max(this->worldMatrixClass, MatrixClass::Rigid), bLocalUpdate);
+}
+
+/*** Quat ***/
+
+void Transform::WorldRotateAroundAxis(float x, float y, float z, float w, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    // NH[^jIŐς ( ꂪȂ )
+    if (bLocalUpdate && this->IsQuaternionRotationMode())
+    {
+        D3DXQUATERNION delta;
+        const D3DXVECTOR3 axis(x, y, z);
+        D3DXQuaternionRotationAxis(&delta, &axis, w);
+        if (this->WorldToLocalRotationDelta(&delta))
+        {
+            this->AccumulateLocalQuaternion(delta, true);
+            return;
+        }
+    }
+
+    D3DXVECTOR3    axis(x, y, z);
+    D3DXVECTOR3    tempLocation = this->GetWorldLocation();
+    D3DXQUATERNION tempQuat(0.0f,0.0f,0.0f,1.0f);
+    D3DXMATRIX     rotationMatrix;
+
+    D3DXQuaternionRotationAxis(&tempQuat, &axis, w);
+    D3DXMatrixRotationQuaternion(&rotationMatrix, &tempQuat);
+
+    this->worldMatrix._41 = 0.0f;
+    this->worldMatrix._42 = 0.0f;
+    this->worldMatrix._43 = 0.0f;
+
+    this->worldMatrix *= rotationMatrix;
+
+    this->worldMatrix._41 = tempLocation.x;
+    this->worldMatrix._42 = tempLocation.y;
+    this->worldMatrix._43 = tempLocation.z;
+
+    this->WorldMatrixChanged(before, std::max(this->worldMatrixClass, MatrixClass::Rigid), bLocalUpdate);
+}
+
+void Transform::WorldRotateAroundAxis(const D3DXVECTOR3* axis, float w, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    // NH[^jIŐς ( ꂪȂ )
+    if (bLocalUpdate && this->IsQuaternionRotationMode())
+    {
+        D3DXQUATERNION delta;
+        D3DXQuaternionRotationAxis(&delta, axis, w);
+        if (this->WorldToLocalRotationDelta(&delta))
+        {
+            this->AccumulateLocalQuaternion(delta, true);
+            return;
+        }
+    }
+
+    D3DXVECTOR3    tempLocation = this->GetWorldLocation();
+    D3DXQUATERNION tempQuat(0.0f, 0.0f, 0.0f, 1.0f);
+    D3DXMATRIX     rotationMatrix;
+
+    D3DXQuaternionRotationAxis(&tempQuat, axis, w);
+    D3DXMatrixRotationQuaternion(&rotationMatrix, &tempQuat);
+
+    this->worldMatrix._41 = 0.0f;
+    this->worldMatrix._42 = 0.0f;
+    this->worldMatrix._43 = 0.0f;
+
+    this->worldMatrix *= rotationMatrix;
+
+    this->worldMatrix._41 = tempLocation.x;
+    this->worldMatrix._42 = tempLocation.y;
+    this->worldMatrix._43 = tempLocation.z;
+
+    this->WorldMatrixChanged(before, std::max(this->worldMatrixClass, MatrixClass::Rigid), bLocalUpdate);
+}
+
+void Transform::SetWorldQuaternion(float x, float y, float z, float w, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    D3DXVECTOR3    axis(x, y, z);
+    D3DXVECTOR3    tempLocation = this->GetWorldLocation();
+    D3DXVECTOR3    tempScale    = this->GetWorldScale();
+    D3DXQUATERNION tempQuat(0.0f,0.0f,0.0f,1.0f);
+    D3DXMATRIX     rotationMatrix;
+
+    D3DXQuaternionRotationAxis(&tempQuat, &axis, w);
+    D3DXMatrixRotationQuaternion(&rotationMatrix, &tempQuat);
+
+    this->worldMatrix
+        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
+
+    this->WorldMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(&tempScale)), bLocalUpdate);
+}
+
+void Transform::SetWorldQuaternion(const D3DXVECTOR3 * axis, float w, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    D3DXVECTOR3    tempLocation = this->GetWorldLocation();
+    D3DXVECTOR3    tempScale    = this->GetWorldScale();
+    D3DXQUATERNION tempQuat(0.0f,0.0f,0.0f,1.0f);
+    D3DXMATRIX     rotationMatrix;
+
+    D3DXQuaternionRotationAxis(&tempQuat, axis, w);
+    D3DXMatrixRotationQuaternion(&rotationMatrix, &tempQuat);
+
+    this->worldMatrix
+        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
+
+    this->WorldMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(&tempScale)), bLocalUpdate);
+}
+
+void Transform::SetWorldQuaternion(const D3DXQUATERNION* quat, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    D3DXVECTOR3 tempLocation = this->GetWorldLocation();
+    D3DXVECTOR3 tempScale    = this->GetWorldScale();
+    D3DXMATRIX  rotationMatrix;
+
+    D3DXMatrixRotationQuaternion(&rotationMatrix, quat);
+
+    this->worldMatrix
+        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
+
+    this->WorldMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(&tempScale)), bLocalUpdate);
+}
+
+/***** local *****/
+
+/*** get ***/
+
+Rotation Transform::GetLocalRotation() const
+{
+    D3DXVECTOR3    dummy = {};
+    D3DXQUATERNION tempQuat = {};
+    D3DXMatrixDecompose(&dummy, &tempQuat, &dummy, &this->localMatrix);
+    return Rotation::QuatToRotation(&tempQuat);
+}
+
+D3DXQUATERNION Transform::GetLocalQuaternion() const
+{
+    // NH[^jI[hōs񂪕ςĂȂΎĂ]
+    if (this->IsQuaternionRotationMode() && this->FindColdData()->localRotationVersion == this->localVersion)
+    {
+        return this->FindColdData()->localRotation;
+    }
+
+    D3DXQUATERNION result;
+    D3DXMATRIX     rotationMatrix = this->GetLocalRotationMatrix();
+
+    D3DXQuaternionRotationMatrix(&result, &rotationMatrix);
+
+    return result;
+}
+
+/*** set ***/
+
+void Transform::SetLocalRotation(const Rotation* const rotation, bool bWorldUpdate)
+{
+    const D3DXMATRIX before = this->localMatrix;
+
+    if (!rotation) return;
+
+    D3DXVECTOR3 tempLocation = this->GetLocalLocation(),
+        tempScale    = this->GetLocalScale();
+
+    this->localMatrix
+        = this->CreateWorldTranslationMatrix(&tempLocation, rotation, &tempScale);
+
+    this->LocalMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(&tempScale)), bWorldUpdate);
+}
+
+void Transform::SetLocalRotation(float yaw, float pitch, float roll, bool bWorldUpdate)
+{
+    const D3DXMATRIX before = this->localMatrix;
+
+    D3DXVECTOR3 tempLocation = this->GetLocalLocation();
+    D3DXVECTOR3 tempScale    = this->GetLocalScale();
+    Rotation    tempRotation(yaw, pitch, roll);
+
+    this->localMatrix 
+        = this->CreateWorldTranslationMatrix(&tempLocation, &tempRotation, &tempScale);
+
+    this->LocalMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(&tempScale)), bWorldUpdate);
+}
+
+/*** add ***/
+
+void Transform::AddLocalRotation(const Rotation* const rotation, bool bWorldUpdate)
+{
+    const D3DXMATRIX before = this->localMatrix;
+
+    if (!rotation) return;
+
+    // NH[^jIŐς ( ꂪȂ )
+    if (this->IsQuaternionRotationMode())
+    {
+        D3DXQUATERNION delta;
+        D3DXQuaternionRotationYawPitchRoll(&delta, rotation->yaw, rotation->pitch, rotation->roll);
+        this->AccumulateLocalQuaternion(delta, bWorldUpdate);
+        return;
+    }
+
+    D3DXVECTOR3 tempLocation = this->GetLocalLocation();
+    D3DXMATRIX  rotationMatrix;
+
+    D3DXMatrixRotationYawPitchRoll(&rotationMatrix, rotation->yaw, rotation->pitch, rotation->roll);
+
+    this->localMatrix._41 = 0.0f;
+    this->localMatrix._42 = 0.0f;
+    this->localMatrix._43 = 0.0f;
+
+    this->localMatrix *= rotationMatrix;
+
+    this->localMatrix._41 = tempLocation.x;
+    this->localMatrix._42 = tempLocation.y;
+    this->localMatrix._43 = tempLocation.z;
+
+    this->LocalMatrixChanged(before, std::max(this->localMatrixClass, MatrixClass::Rigid), bWorldUpdate);
+}
+
+void Transform::AddLocalRotation(float yaw, float pitch, float roll, bool bWorldUpdate)
+{
+    const D3DXMATRIX before = this->localMatrix;
+
+    // NH[^jIŐς ( ꂪȂ )
+    if (this->IsQuaternionRotationMode())
+    {
+        D3DXQUATERNION delta;
+        D3DXQuaternionRotationYawPitchRoll(&delta, yaw, pitch, roll);
+        this->AccumulateLocalQuaternion(delta, bWorldUpdate);
+        return;
+    }
+
+    D3DXVECTOR3 tempLocation = this->GetLocalLocation();
+    D3DXMATRIX  rotationMatrix;
+
+    D3DXMatrixRotationYawPitchRoll(&rotationMatrix, yaw, pitch, roll);
+
+    this->localMatrix._41 = 0.0f;
+    this->localMatrix._42 = 0.0f;
+    this->localMatrix._43 = 0.0f;
+
+    this->localMatrix *= rotationMatrix;
+
+    this->localMatrix._41 = tempLocation.x;
+    this->localMatrix._42 = tempLocation.y;
+    this->localMatrix._43 = tempLocation.z;
+
+    this->LocalMatrixChanged(before, std::max(this->localMatrixClass, MatrixClass::Rigid), bWorldUpdate);
+}
+
+/*** Quat ***/
+
+void Transform::LocalRotateAroundAxis(float x, float y, float z, float w, bool bWorldUpdate)
+{
+    const D3DXMATRIX before = this->localMatrix;
+
+    // NH[^jIŐς ( ꂪȂ )
+    if (this->IsQuaternionRotationMode())
+    {
+        D3DXQUATERNION delta;
+        const D3DXVECTOR3 axis(x, y, z);
+        D3DXQuaternionRotationAxis(&delta, &axis, w);
+        this->AccumulateLocalQuaternion(delta, bWorldUpdate);
+        return;
+    }
+
+    D3DXVECTOR3    axis(x, y, z);
+    D3DXVECTOR3    tempLocation = this->GetLocalLocation();
+    D3DXQUATERNION tempQuat(0,0,0,1);
+    D3DXMATRIX     rotationMatrix;
+
+    D3DXQuaternionRotationAxis(&tempQuat, &axis, w);
+    D3DXMatrixRotationQuaternion(&rotationMatrix, &tempQuat);
 
-void Transform::SetLocalLocation(const D3DXVECTOR3* const location, bool bWorldUpdate)
-{
-    this->localMatrix._41 = location->x;
-    this->localMatrix._42 = location->y;
-    this->localMatrix._43 = location->z;
+    this->localMatrix._41 = 0.0f;
+    this->localMatrix._42 = 0.0f;
+    this->localMatrix._43 = 0.0f;
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
-}
+    this->localMatrix *= rotationMatrix;
 
-void Transform::SetLocalLocation(float x, float y, float z, bool bWorldUpdate)
-{
-    this->localMatrix._41 = x;
-    this->localMatrix._42 = y;
-    this->localMatrix._43 = z;
+    this->localMatrix._41 = tempLocation.x;
+    this->localMatrix._42 = tempLocation.y;
+    this->localMatrix._43 = tempLocation.z;
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
+    this->LocalMatrixChanged(before, std::max(this->localMatrixClass, MatrixClass::Rigid), bWorldUpdate);
 }
 
-void Transform::SetLocalLocationX(float x, bool bWorldUpdate)
+void Transform::LocalRotateAroundAxis(const D3DXVECTOR3* axis, float w, bool bWorldUpdate)
 {
-    this->localMatrix._41 = x;
+    const D3DXMATRIX before = this->localMatrix;
+
+    // NH[^jIŐς ( ꂪȂ )
+    if (this->IsQuaternionRotationMode())
+    {
+        D3DXQUATERNION delta;
+        D3DXQuaternionRotationAxis(&delta, axis, w);
+        this->AccumulateLocalQuaternion(delta, bWorldUpdate);
+        return;
+    }
+
+    D3DXVECTOR3    tempLocation = this->GetLocalLocation();
+    D3DXQUATERNION tempQuat(0,0,0,1);
+    D3DXMATRIX     rotationMatrix;
+
+    D3DXQuaternionRotationAxis(&tempQuat, axis, w);
+    D3DXMatrixRotationQuaternion(&rotationMatrix, &tempQuat);
+
+    this->localMatrix._41 = 0.0f;
+    this->localMatrix._42 = 0.0f;
+    this->localMatrix._43 = 0.0f;
+
+    this->localMatrix *= rotationMatrix;
+
+    this->localMatrix._41 = tempLocation.x;
+    this->localMatrix._42 = tempLocation.y;
+    this->localMatrix._43 = tempLocation.z;
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
+    this->LocalMatrixChanged(before, std::max(this->localMatrixClass, MatrixClass::Rigid), bWorldUpdate);
 }
 
-void Transform::SetLocalLocationY(float y, bool bWorldUpdate)
+void Transform::SetLocalQuaternion(float x, float y, float z, float w, bool bWorldUpdate)
 {
-    this->localMatrix._42 = y;
+    const D3DXMATRIX before = this->localMatrix;
+
+    D3DXVECTOR3    axis(x, y, z);
+    D3DXVECTOR3    tempLocation = this->GetLocalLocation();
+    D3DXVECTOR3    tempScale    = this->GetLocalScale();
+    D3DXQUATERNION tempQuat(0.0f,0.0f,0.0f,1.0f);
+    D3DXMATRIX     rotationMatrix;
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
+    D3DXQuaternionRotationAxis(&tempQuat, &axis, w);
+    D3DXMatrixRotationQuaternion(&rotationMatrix, &tempQuat);
+
+    this->localMatrix
+        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
+
+    this->LocalMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(&tempScale)), bWorldUpdate);
 }
 
-void Transform::SetLocalLocationZ(float z, bool bWorldUpdate)
+void Transform::SetLocalQuaternion(const D3DXVECTOR3 * axis, float w, bool bWorldUpdate)
 {
-    this->localMatrix._43 = z;
+    const D3DXMATRIX before = this->localMatrix;
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
-}
+    D3DXVECTOR3    tempLocation = this->GetLocalLocation();
+    D3DXVECTOR3    tempScale    = this->GetLocalScale();
+    D3DXQUATERNION tempQuat(0.0f,0.0f,0.0f,1.0f);
+    D3DXMATRIX     rotationMatrix;
 
-/*** add ***/
+    D3DXQuaternionRotationAxis(&tempQuat, axis, w);
+    D3DXMatrixRotationQuaternion(&rotationMatrix, &tempQuat);
 
-void Transform::AddLocalLocation(const D3DXVECTOR3* const location, bool bWorldUpdate)
-{
-    this->localMatrix._41 += location->x;
-    this->localMatrix._42 += location->y;
-    this->localMatrix._43 += location->z;
+    this->localMatrix
+        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
+    this->LocalMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(&tempScale)), bWorldUpdate);
 }
 
-void Transform::AddLocalLocation(float x, float y, float z, bool bWorldUpdate)
+void Transform::SetLocalQuaternion(const D3DXQUATERNION * quat, bool bWorldUpdate)
 {
-    this->localMatrix._41 += x;
-    this->localMatrix._42 += y;
-    this->localMatrix._43 += z;
+    const D3DXMATRIX before = this->localMatrix;
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
-}
+    D3DXVECTOR3 tempLocation = this->GetLocalLocation();
+    D3DXVECTOR3 tempScale    = this->GetLocalScale();
+    D3DXMATRIX  rotationMatrix;
 
+    D3DXMatrixRotationQuaternion(&rotationMatrix, quat);
 
+    this->localMatrix
+        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
 
-/**************************************** ] ****************************************/
+    this->LocalMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(&tempScale)), bWorldUpdate);
 
-/***** world *****/
+    // ZbgNH[^jÎ܂܎ ( s񂩂番Ȃ )
+    if (this->IsQuaternionRotationMode())
+    {
+        ColdData& cold = this->GetColdData();
+        D3DXQuaternionNormalize(&cold.localRotation, quat);
+        cold.localScale           = tempScale;
+        cold.localRotationVersion = this->localVersion;
+    }
+}
 
-/*** get ***/
+/*** quaternion mode ***/
 
-Rotation Transform::GetWorldRotation() const
+void Transform::SetQuaternionRotationMode(bool bEnable)
 {
-    D3DXVECTOR3    dummy = {};
-    D3DXQUATERNION tempQuat = {};
-    D3DXMatrixDecompose(&dummy, &tempQuat, &dummy, &this->worldMatrix);
-    return Rotation::QuatToRotation(&tempQuat);
+    if (!bEnable && !this->FindColdData()) return;
+
+    ColdData& cold = this->GetColdData();
+    cold.bQuaternionRotation  = bEnable;
+    cold.localRotationVersion = 0;	// ̉]ŕ
 }
 
-D3DXQUATERNION Transform::GetWorldQuaternion() const
+bool Transform::IsQuaternionRotationMode() const
 {
-    D3DXQUATERNION result;
-    D3DXMATRIX     rotationMatrix = this->GetWorldRotationMatrix();
+    const ColdData* const cold = this->FindColdData();
+    return cold && cold->bQuaternionRotation;
+}
 
-    D3DXQuaternionRotationMatrix(&result, &rotationMatrix);
+void Transform::AccumulateLocalQuaternion(const D3DXQUATERNION& delta, bool bWorldUpdate)
+{
+    const D3DXMATRIX before = this->localMatrix;
 
-    return result;
-}
+    ColdData& cold = this->GetColdData();
 
-/*** set ***/
+    // ق̕@Ń[Js񂪕ςĂ番
+    if (cold.localRotationVersion != this->localVersion)
+    {
+        cold.localScale = this->GetLocalScale();
 
-void Transform::SetWorldRotation(const Rotation* const rotation, bool bLocalUpdate)
-{
-    if (!rotation) return;
+        const D3DXMATRIX rotationMatrix = this->GetLocalRotationMatrix();
+        D3DXQuaternionRotationMatrix(&cold.localRotation, &rotationMatrix);
+        D3DXQuaternionNormalize(&cold.localRotation, &cold.localRotation);
+    }
 
-    D3DXVECTOR3 tempLocation = this->GetWorldLocation(),
-        tempScale    = this->GetWorldScale();
+    // ̉]̌ delta ( sxNgȂ̂ localMatrix * delta Ɠ )
+    D3DXQUATERNION rotation;
+    D3DXQuaternionMultiply(&rotation, &cold.localRotation, &delta);
 
-    this->worldMatrix 
-        = this->CreateWorldTranslationMatrix(&tempLocation, rotation, &tempScale); 
+    // ͂ق 1 Ȃ̂ŁȂ 1 / sqrt(x)  (3 - x) / 2 ŐK
+    const float lengthSq = D3DXQuaternionDot(&rotation, &rotation);
+    rotation *= (3.0f - lengthSq) * 0.5f;
+    cold.localRotation = rotation;
+
+    // [Js蒼 ( W͂̂܂ )
+    const D3DXVECTOR3 tempLocation = this->GetLocalLocation();
+    D3DXMATRIX        rotationMatrix;
+    D3DXMatrixRotationQuaternion(&rotationMatrix, &rotation);
+
+    this->localMatrix = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &cold.localScale);
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
+    this->LocalMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(&cold.localScale)), bWorldUpdate);
+
+    cold.localRotationVersion = this->localVersion;
 }
 
-void Transform::SetWorldRotation(float yaw, float pitch, float roll, bool bLocalUpdate)
+bool Transform::WorldToLocalRotationDelta(D3DXQUATERNION* const delta) const
 {
-    D3DXVECTOR3 tempLocation = this->GetWorldLocation();
-    D3DXVECTOR3 tempScale    = this->GetWorldScale();
-    Rotation    tempRotation(yaw, pitch, roll);
+    if (!this->parentTransform) return true;
 
-    this->worldMatrix 
-        = this->CreateWorldTranslationMatrix(&tempLocation, &tempRotation, &tempScale);
+    // esψȊgk܂ނƉ]ł͕\Ȃ
+    const MatrixClass parentClass = this->parentTransform->GetWorldMatrixClass();
+    if (parentClass > MatrixClass::UniformScale) return false;
+
+    // e]ĂȂ΂̂܂
+    if (parentClass <= MatrixClass::Translation) return true;
+
+    // ẻ]͐K ( [hs̔łƂ̃LbV )  ( ͂̕Ȃ )
+    const Basis& basis = this->parentTransform->GetBasis();
+    if (basis.inverseScale.x == 0.0f) return false;
+
+    // ̋ψgk͑SĂ̎]Ă̂Ŗ߂
+    D3DXVECTOR3 cross;
+    D3DXVec3Cross(&cross, &basis.right, &basis.up);
+    const float sign = (D3DXVec3Dot(&cross, &basis.forward) < 0.0f) ? -1.0f : 1.0f;
+
+    const D3DXMATRIX rotationMatrix
+    (
+        basis.right.x   * sign, basis.right.y   * sign, basis.right.z   * sign, 0.0f,
+        basis.up.x      * sign, basis.up.y      * sign, basis.up.z      * sign, 0.0f,
+        basis.forward.x * sign, basis.forward.y * sign, basis.forward.z * sign, 0.0f,
+        0.0f,                   0.0f,                   0.0f,                   1.0f
+    );
+
+    // [J̉] = ẻ]  delta  ẻ]̋t
+    D3DXQUATERNION parentRotation, parentInverse, temp;
+    D3DXQuaternionRotationMatrix(&parentRotation, &rotationMatrix);
+    D3DXQuaternionNormalize(&parentRotation, &parentRotation);
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
+    D3DXQuaternionConjugate(&parentInverse, &parentRotation);
+    D3DXQuaternionMultiply(&temp, &parentRotation, delta);
+    D3DXQuaternionMultiply(delta, &temp, &parentInverse);
+
+    return true;
 }
 
-/*** add ***/
 
-void Transform::AddWorldRotation(const Rotation* const rotation, bool bLocalUpdate)
-{
-    if (!rotation) return;
 
-    D3DXVECTOR3 tempLocation = this->GetWorldLocation();
-    D3DXMATRIX  rotationMatrix;
+/**************************************** gk ****************************************/
 
-    D3DXMatrixRotationYawPitchRoll(&rotationMatrix, rotation->yaw, rotation->pitch, rotation->roll);
+/***** world *****/
 
-    this->worldMatrix._41 = 0.0f;
-    this->worldMatrix._42 = 0.0f;
-    this->worldMatrix._43 = 0.0f;
+/*** get ***/
 
-    this->worldMatrix *= rotationMatrix;
+D3DXVECTOR3 Transform::GetWorldScale() const
+{
+    this->RefreshWorldMatrix();
 
-    this->worldMatrix._41 = tempLocation.x;
-    this->worldMatrix._42 = tempLocation.y;
-    this->worldMatrix._43 = tempLocation.z;
+    D3DXVECTOR3 directions[3] =
+    {
+        {this->worldMatrix._11, this->worldMatrix._12, this->worldMatrix._13},
+        {this->worldMatrix._21, this->worldMatrix._22, this->worldMatrix._23},
+        {this->worldMatrix._31, this->worldMatrix._32, this->worldMatrix._33}
+    };
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
+    return D3DXVECTOR3
+    (
+        D3DXVec3Length(&directions[0]),
+        D3DXVec3Length(&directions[1]),
+        D3DXVec3Length(&directions[2])
+    );
 }
 
-void Transform::AddWorldRotation(float yaw, float pitch, float roll, bool bLocalUpdate)
-{
-    D3DXVECTOR3 tempLocation = this->GetWorldLocation();
-    D3DXMATRIX  rotationMatrix;
+/*** set ***/
 
-    D3DXMatrixRotationYawPitchRoll(&rotationMatrix, yaw, pitch, roll);
+void Transform::SetWorldScale(const D3DXVECTOR3* const scale, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
 
-    this->worldMatrix._41 = 0.0f;
-    this->worldMatrix._42 = 0.0f;
-    this->worldMatrix._43 = 0.0f;
+    if (!scale) return;
 
-    this->worldMatrix *= rotationMatrix;
+    D3DXVECTOR3 tempLocation   = this->GetWorldLocation();
+    D3DXMATRIX  rotationMatrix = this->GetWorldRotationMatrix();
 
-    this->worldMatrix._41 = tempLocation.x;
-    this->worldMatrix._42 = tempLocation.y;
-    this->worldMatrix._43 = tempLocation.z;
+    this->worldMatrix
+        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, scale);
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
+    this->WorldMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(scale)), bLocalUpdate);
 }
 
-/*** Quat ***/
-
-void Transform::WorldRotateAroundAxis(float x, float y, float z, float w, bool bLocalUpdate)
+void Transform::SetWorldScale(float x, float y, float z, bool bLocalUpdate)
 {
-    D3DXVECTOR3    axis(x, y, z);
-    D3DXVECTOR3    tempLocation = this->GetWorldLocation();
-    D3DXQUATERNION tempQuat(0.0f,0.0f,0.0f,1.0f);
-    D3DXMATRIX     rotationMatrix;
+    const D3DXMATRIX before = this->worldMatrix;
 
-    D3DXQuaternionRotationAxis(&tempQuat, &axis, w);
-    D3DXMatrixRotationQuaternion(&rotationMatrix, &tempQuat);
+    D3DXVECTOR3 tempLocation   = this->GetWorldLocation();
+    D3DXVECTOR3 tempScale      = { x, y, z };
+    D3DXMATRIX  rotationMatrix = this->GetWorldRotationMatrix();
 
-    this->worldMatrix._41 = 0.0f;
-    this->worldMatrix._42 = 0.0f;
-    this->worldMatrix._43 = 0.0f;
+    this->worldMatrix
+        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
 
-    this->worldMatrix *= rotationMatrix;
+    this->WorldMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(&tempScale)), bLocalUpdate);
+}
 
-    this->worldMatrix._41 = tempLocation.x;
-    this->worldMatrix._42 = tempLocation.y;
-    this->worldMatrix._43 = tempLocation.z;
+void Transform::SetWorldScaleX(float x, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
+    D3DXVECTOR3 scale = this->GetWorldScale();
+    float       mult  = x / scale.x;
+    scale.x = x;
+
+    this->worldMatrix._11 *= mult;
+    this->worldMatrix._12 *= mult;
+    this->worldMatrix._13 *= mult;
+
+    this->WorldMatrixChanged(before, Transform::ScaledClass(this->worldMatrixClass, &scale), bLocalUpdate);
 }
 
-void Transform::WorldRotateAroundAxis(const D3DXVECTOR3* axis, float w, bool bLocalUpdate)
+void Transform::SetWorldScaleY(float y, bool bLocalUpdate)
 {
-    D3DXVECTOR3    tempLocation = this->GetWorldLocation();
-    D3DXQUATERNION tempQuat(0.0f, 0.0f, 0.0f, 1.0f);
-    D3DXMATRIX     rotationMatrix;
+    const D3DXMATRIX before = this->worldMatrix;
 
-    D3DXQuaternionRotationAxis(&tempQuat, axis, w);
-    D3DXMatrixRotationQuaternion(&rotationMatrix, &tempQuat);
+    D3DXVECTOR3 scale = this->GetWorldScale();
+    float       mult  = y / scale.y;
+    scale.y = y;
 
-    this->worldMatrix._41 = 0.0f;
-    this->worldMatrix._42 = 0.0f;
-    this->worldMatrix._43 = 0.0f;
+    this->worldMatrix._21 *= mult;
+    this->worldMatrix._22 *= mult;
+    this->worldMatrix._23 *= mult;
 
-    this->worldMatrix *= rotationMatrix;
+    this->WorldMatrixChanged(before, Transform::ScaledClass(this->worldMatrixClass, &scale), bLocalUpdate);
+}
 
-    this->worldMatrix._41 = tempLocation.x;
-    this->worldMatrix._42 = tempLocation.y;
-    this->worldMatrix._43 = tempLocation.z;
+void Transform::SetWorldScaleZ(float z, bool bLocalUpdate)
+{
+    const D3DXMATRIX before = this->worldMatrix;
+
+    D3DXVECTOR3 scale = this->GetWorldScale();
+    float       mult  = z / scale.z;
+    scale.z = z;
+
+    this->worldMatrix._31 *= mult;
+    this->worldMatrix._32 *= mult;
+    this->worldMatrix._33 *= mult;
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
+    this->WorldMatrixChanged(before, Transform::ScaledClass(this->worldMatrixClass, &scale), bLocalUpdate);
 }
 
-void Transform::SetWorldQuaternion(float x, float y, float z, float w, bool bLocalUpdate)
+/*** add ***/
+
+void Transform::AddWorldScale(const D3DXVECTOR3* const scale, bool bLocalUpdate)
 {
-    D3DXVECTOR3    axis(x, y, z);
-    D3DXVECTOR3    tempLocation = this->GetWorldLocation();
-    D3DXVECTOR3    tempScale    = this->GetWorldScale();
-    D3DXQUATERNION tempQuat(0.0f,0.0f,0.0f,1.0f);
-    D3DXMATRIX     rotationMatrix;
+    const D3DXMATRIX before = this->worldMatrix;
+
+    if (!scale) return;
 
-    D3DXQuaternionRotationAxis(&tempQuat, &axis, w);
-    D3DXMatrixRotationQuaternion(&rotationMatrix, &tempQuat);
+    D3DXVECTOR3 tempLocation   = this->GetWorldLocation();
+    D3DXVECTOR3 tempScale      = this->GetWorldScale() + *scale;
+    D3DXMATRIX  rotationMatrix = this->GetWorldRotationMatrix();
 
     this->worldMatrix
         = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
+    this->WorldMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(&tempScale)), bLocalUpdate);
 }
 
-void Transform::SetWorldQuaternion(const D3DXVECTOR3 * axis, float w, bool bLocalUpdate)
+void Transform::AddWorldScale(float x, float y, float z, bool bLocalUpdate)
 {
-    D3DXVECTOR3    tempLocation = this->GetWorldLocation();
-    D3DXVECTOR3    tempScale    = this->GetWorldScale();
-    D3DXQUATERNION tempQuat(0.0f,0.0f,0.0f,1.0f);
-    D3DXMATRIX     rotationMatrix;
+    const D3DXMATRIX before = this->worldMatrix;
 
-    D3DXQuaternionRotationAxis(&tempQuat, axis, w);
-    D3DXMatrixRotationQuaternion(&rotationMatrix, &tempQuat);
+    D3DXVECTOR3 tempLocation   = this->GetWorldLocation();
+    D3DXVECTOR3 tempScale      = this->GetWorldScale() + D3DXVECTOR3(x, y, z);
+    D3DXMATRIX  scaleMatrix, rotationInverse;
+    D3DXMATRIX  rotationMatrix = this->GetWorldRotationMatrix();
 
-    this->worldMatrix
-        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
+    //this->worldMatrix._41 = 0;
+    //this->worldMatrix._42 = 0;
+    //this->worldMatrix._43 = 0;
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
-}
+    //D3DXMatrixInverse(&rotationInverse, nullptr, &rotationMatrix);
 
-void Transform::SetWorldQuaternion(const D3DXQUATERNION* quat, bool bLocalUpdate)
-{
-    D3DXVECTOR3 tempLocation = this->GetWorldLocation();
-    D3DXVECTOR3 tempScale    = this->GetWorldScale();
-    D3DXMATRIX  rotationMatrix;
+    //D3DXMatrixScaling(&scaleMatrix, x, y, z);
+    //this->worldMatrix = this->worldMatrix * rotationInverse * scaleMatrix * rotationMatrix;
 
-    D3DXMatrixRotationQuaternion(&rotationMatrix, quat);
+    //this->worldMatrix._41 = tempLocation.x;
+    //this->worldMatrix._42 = tempLocation.y;
+    //this->worldMatrix._43 = tempLocation.z;
 
     this->worldMatrix
         = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
+    this->WorldMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(&tempScale)), bLocalUpdate);
 }
 
 /***** local *****/
 
 /*** get ***/
 
-Rotation Transform::GetLocalRotation() const
-{
-    D3DXVECTOR3    dummy = {};
-    D3DXQUATERNION tempQuat = {};
-    D3DXMatrixDecompose(&dummy, &tempQuat, &dummy, &this->localMatrix);
-    return Rotation::QuatToRotation(&tempQuat);
-}
-
-D3DXQUATERNION Transform::GetLocalQuaternion() const
+D3DXVECTOR3 Transform::GetLocalScale() const
 {
-    D3DXQUATERNION result;
-    D3DXMATRIX     rotationMatrix = this->GetLocalRotationMatrix();
-
-    D3DXQuaternionRotationMatrix(&result, &rotationMatrix);
+    D3DXVECTOR3 directions[3] =
+    {
+        {this->localMatrix._11, this->localMatrix._12, this->localMatrix._13},
+        {this->localMatrix._21, this->localMatrix._22, this->localMatrix._23},
+        {this->localMatrix._31, this->localMatrix._32, this->localMatrix._33}
+    };
 
-    return result;
+    return D3DXVECTOR3
+    (
+        D3DXVec3Length(&directions[0]),
+        D3DXVec3Length(&directions[1]),
+        D3DXVec3Length(&directions[2])
+    );
 }
 
 /*** set ***/
 
-void Transform::SetLocalRotation(const Rotation* const rotation, bool bWorldUpdate)
+void Transform::SetLocalScale(const D3DXVECTOR3* const scale, bool bWorldUpdate)
 {
-    if (!rotation) return;
+    const D3DXMATRIX before = this->localMatrix;
 
-    D3DXVECTOR3 tempLocation = this->GetLocalLocation(),
-        tempScale    = this->GetLocalScale();
+    if (!scale) return;
+
+    D3DXVECTOR3 tempLocation   = this->GetLocalLocation();
+    D3DXMATRIX  rotationMatrix = this->GetLocalRotationMatrix();
 
     this->localMatrix
-        = this->CreateWorldTranslationMatrix(&tempLocation, rotation, &tempScale);
+        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, scale);
 
-    this->UpdateWorldMatrix();
+    this->LocalMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(scale)), bWorldUpdate);
 }
 
-void Transform::SetLocalRotation(float yaw, float pitch, float roll, bool bWorldUpdate)
+void Transform::SetLocalScale(float x, float y, float z, bool bWorldUpdate)
 {
-    D3DXVECTOR3 tempLocation = this->GetLocalLocation();
-    D3DXVECTOR3 tempScale    = this->GetLocalScale();
-    Rotation    tempRotation(yaw, pitch, roll);
+    const D3DXMATRIX before = this->localMatrix;
 
-    this->localMatrix 
-        = this->CreateWorldTranslationMatrix(&tempLocation, &tempRotation, &tempScale);
+    D3DXVECTOR3 tempLocation   = this->GetLocalLocation();
+    D3DXVECTOR3 tempScale      = { x, y, z };
+    D3DXMATRIX  rotationMatrix = this->GetLocalRotationMatrix();
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
-}
+    this->localMatrix
+        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
 
-/*** add ***/
+    this->LocalMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(&tempScale)), bWorldUpdate);
+}
 
-void Transform::AddLocalRotation(const Rotation* const rotation, bool bWorldUpdate)
+void Transform::SetLocalScaleX(float x, bool bWorldUpdate)
 {
-    if (!rotation) return;
-
-    D3DXVECTOR3 tempLocation = this->GetLocalLocation();
-    D3DXMATRIX  rotationMatrix;
-
-    D3DXMatrixRotationYawPitchRoll(&rotationMatrix, rotation->yaw, rotation->pitch, rotation->roll);
-
-    this->localMatrix._41 = 0.0f;
-    this->localMatrix._42 = 0.0f;
-    this->localMatrix._43 = 0.0f;
+    const D3DXMATRIX before = this->localMatrix;
 
-    this->localMatrix *= rotationMatrix;
+    D3DXVECTOR3 scale = this->GetLocalScale();
+    float       mult  = x / scale.x;
+    scale.x = x;
 
-    this->localMatrix._41 = tempLocation.x;
-    this->localMatrix._42 = tempLocation.y;
-    this->localMatrix._43 = tempLocation.z;
+    this->localMatrix._11 *= mult;
+    this->localMatrix._12 *= mult;
+    this->localMatrix._13 *= mult;
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
+    this->LocalMatrixChanged(before, Transform::ScaledClass(this->localMatrixClass, &scale), bWorldUpdate);
 }
 
-void Transform::AddLocalRotation(float yaw, float pitch, float roll, bool bWorldUpdate)
+void Transform::SetLocalScaleY(float y, bool bWorldUpdate)
 {
-    D3DXVECTOR3 tempLocation = this->GetLocalLocation();
-    D3DXMATRIX  rotationMatrix;
+    const D3DXMATRIX before = this->localMatrix;
 
-    D3DXMatrixRotationYawPitchRoll(&rotationMatrix, yaw, pitch, roll);
-
-    this->localMatrix._41 = 0.0f;
-    this->localMatrix._42 = 0.0f;
-    this->localMatrix._43 = 0.0f;
-
-    this->localMatrix *= rotationMatrix;
+    D3DXVECTOR3 scale = this->GetLocalScale();
+    float       mult  = y / scale.y;
+    scale.y = y;
 
-    this->localMatrix._41 = tempLocation.x;
-    this->localMatrix._42 = tempLocation.y;
-    this->localMatrix._43 = tempLocation.z;
+    this->localMatrix._21 *= mult;
+    this->localMatrix._22 *= mult;
+    this->localMatrix._23 *= mult;
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
+    this->LocalMatrixChanged(before, Transform::ScaledClass(this->localMatrixClass, &scale), bWorldUpdate);
 }
 
-/*** Quat ***/
-
-void Transform::LocalRotateAroundAxis(float x, float y, float z, float w, bool bWorldUpdate)
+void Transform::SetLocalScaleZ(float z, bool bWorldUpdate)
 {
-    D3DXVECTOR3    axis(x, y, z);
-    D3DXVECTOR3    tempLocation = this->GetLocalLocation();
-    D3DXQUATERNION tempQuat(0,0,0,1);
-    D3DXMATRIX     rotationMatrix;
-
-    D3DXQuaternionRotationAxis(&tempQuat, &axis, w);
-    D3DXMatrixRotationQuaternion(&rotationMatrix, &tempQuat);
+    const D3DXMATRIX before = this->localMatrix;
 
-    this->localMatrix._41 = 0.0f;
-    this->localMatrix._42 = 0.0f;
-    this->localMatrix._43 = 0.0f;
-
-    this->localMatrix *= rotationMatrix;
+    D3DXVECTOR3 scale = this->GetLocalScale();
+    float       mult  = z / scale.z;
+    scale.z = z;
 
-    this->localMatrix._41 = tempLocation.x;
-    this->localMatrix._42 = tempLocation.y;
-    this->localMatrix._43 = tempLocation.z;
+    this->localMatrix._31 *= mult;
+    this->localMatrix._32 *= mult;
+    this->localMatrix._33 *= mult;
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
+    this->LocalMatrixChanged(before, Transform::ScaledClass(this->localMatrixClass, &scale), bWorldUpdate);
 }
 
-void Transform::LocalRotateAroundAxis(const D3DXVECTOR3* axis, float w, bool bWorldUpdate)
-{
-    D3DXVECTOR3    tempLocation = this->GetLocalLocation();
-    D3DXQUATERNION tempQuat(0,0,0,1);
-    D3DXMATRIX     rotationMatrix;
+/*** add ***/
 
-    D3DXQuaternionRotationAxis(&tempQuat, axis, w);
-    D3DXMatrixRotationQuaternion(&rotationMatrix, &tempQuat);
+void Transform::AddLocalScale(const D3DXVECTOR3* const scale, bool bWorldUpdate)
+{
+    const D3DXMATRIX before = this->localMatrix;
 
-    this->localMatrix._41 = 0.0f;
-    this->localMatrix._42 = 0.0f;
-    this->localMatrix._43 = 0.0f;
+    if (!scale) return;
 
-    this->localMatrix *= rotationMatrix;
+    D3DXVECTOR3 tempLocation   = this->GetLocalLocation();
+    D3DXVECTOR3 tempScale      = this->GetLocalScale() + *scale;
+    D3DXMATRIX  rotationMatrix = this->GetLocalRotationMatrix();
 
-    this->localMatrix._41 = tempLocation.x;
-    this->localMatrix._42 = tempLocation.y;
-    this->localMatrix._43 = tempLocation.z;
+    this->localMatrix
+        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
+    this->LocalMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(&tempScale)), bWorldUpdate);
 }
 
-void Transform::SetLocalQuaternion(float x, float y, float z, float w, bool bWorldUpdate)
+void Transform::AddLocalScale(float x, float y, float z, bool bWorldUpdate)
 {
-    D3DXVECTOR3    axis(x, y, z);
-    D3DXVECTOR3    tempLocation = this->GetLocalLocation();
-    D3DXVECTOR3    tempScale    = this->GetLocalScale();
-    D3DXQUATERNION tempQuat(0.0f,0.0f,0.0f,1.0f);
-    D3DXMATRIX     rotationMatrix;
+    const D3DXMATRIX before = this->localMatrix;
 
-    D3DXQuaternionRotationAxis(&tempQuat, &axis, w);
-    D3DXMatrixRotationQuaternion(&rotationMatrix, &tempQuat);
+    D3DXVECTOR3 tempLocation   = this->GetLocalLocation();
+    D3DXVECTOR3 tempScale      = this->GetLocalScale() + D3DXVECTOR3(x, y, z);
+    D3DXMATRIX  rotationMatrix = this->GetLocalRotationMatrix();
 
     this->localMatrix
         = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
+    this->LocalMatrixChanged(before, std::max(MatrixClass::Rigid, Transform::ClassifyScale(&tempScale)), bWorldUpdate);
 }
 
-void Transform::SetLocalQuaternion(const D3DXVECTOR3 * axis, float w, bool bWorldUpdate)
-{
-    D3DXVECTOR3    tempLocation = this->GetLocalLocation();
-    D3DXVECTOR3    tempScale    = this->GetLocalScale();
-    D3DXQUATERNION tempQuat(0.0f,0.0f,0.0f,1.0f);
-    D3DXMATRIX     rotationMatrix;
 
-    D3DXQuaternionRotationAxis(&tempQuat, axis, w);
-    D3DXMatrixRotationQuaternion(&rotationMatrix, &tempQuat);
+/****************************************  ****************************************/
 
-    this->localMatrix
-        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
+D3DXVECTOR3 Transform::GetForwardVector() const
+{
+    return this->GetBasis().forward;
+}
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
+D3DXVECTOR3 Transform::GetUpVector() const
+{
+    return this->GetBasis().up;
 }
 
-void Transform::SetLocalQuaternion(const D3DXQUATERNION * quat, bool bWorldUpdate)
+D3DXVECTOR3 Transform::GetRightVector() const
 {
-    D3DXVECTOR3 tempLocation = this->GetLocalLocation();
-    D3DXVECTOR3 tempScale    = this->GetLocalScale();
-    D3DXMATRIX  rotationMatrix;
+    return this->GetBasis().right;
+}
 
-    D3DXMatrixRotationQuaternion(&rotationMatrix, quat);
+D3DXVECTOR3 Transform::GetLocalForwardVector() const
+{
+    return this->GetLocalBasis().forward;
+}
 
-    this->localMatrix
-        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
+D3DXVECTOR3 Transform::GetLocalUpVector() const
+{
+    return this->GetLocalBasis().up;
+}
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
+D3DXVECTOR3 Transform::GetLocalRightVector() const
+{
+    return this->GetLocalBasis().right;
 }
 
+const Transform::Basis& Transform::GetBasis() const
+{
+    this->RefreshWorldMatrix();
 
+    ColdData& cold = this->GetColdData();
 
-/**************************************** gk ****************************************/
+    if (cold.basisVersion.load(std::memory_order_acquire) != this->worldVersion)
+    {
+        std::lock_guard<std::mutex> lock(cold.fillMutex);
 
-/***** world *****/
+        if (cold.basisVersion.load(std::memory_order_relaxed) != this->worldVersion)
+        {
+            Transform::CalcBasis(&cold.basis, this->worldMatrix);
+            cold.basisVersion.store(this->worldVersion, std::memory_order_release);
+        }
+    }
 
-/*** get ***/
+    return cold.basis;
+}
 
-D3DXVECTOR3 Transform::GetWorldScale() const
+const Transform::Basis& Transform::GetLocalBasis() const
 {
-    D3DXVECTOR3 directions[3] =
+    ColdData& cold = this->GetColdData();
+
+    if (cold.localBasisVersion.load(std::memory_order_acquire) != this->localVersion)
     {
-        {this->worldMatrix._11, this->worldMatrix._12, this->worldMatrix._13},
-        {this->worldMatrix._21, this->worldMatrix._22, this->worldMatrix._23},
-        {this->worldMatrix._31, this->worldMatrix._32, this->worldMatrix._33}
-    };
+        std::lock_guard<std::mutex> lock(cold.fillMutex);
 
-    return D3DXVECTOR3
-    (
-        D3DXVec3Length(&directions[0]),
-        D3DXVec3Length(&directions[1]),
-        D3DXVec3Length(&directions[2])
-    );
+        if (cold.localBasisVersion.load(std::memory_order_relaxed) != this->localVersion)
+        {
+            Transform::CalcBasis(&cold.localBasis, this->localMatrix);
+            cold.localBasisVersion.store(this->localVersion, std::memory_order_release);
+        }
+    }
+
+    return cold.localBasis;
 }
 
-/*** set ***/
 
-void Transform::SetWorldScale(const D3DXVECTOR3* const scale, bool bLocalUpdate)
-{
-    if (!scale) return;
 
-    D3DXVECTOR3 tempLocation   = this->GetWorldLocation();
-    D3DXMATRIX  rotationMatrix = this->GetWorldRotationMatrix();
 
-    this->worldMatrix
-        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, scale);
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
-}
+/**************************************** ꊇϊ ****************************************/
 
-void Transform::SetWorldScale(float x, float y, float z, bool bLocalUpdate)
+bool Transform::TransformPoints(std::span<const D3DXVECTOR3> points, std::span<D3DXVECTOR3> out) const
 {
-    D3DXVECTOR3 tempLocation   = this->GetWorldLocation();
-    D3DXVECTOR3 tempScale      = { x, y, z };
-    D3DXMATRIX  rotationMatrix = this->GetWorldRotationMatrix();
+    TRANSFORM_TRACE_SCOPE("Transform.TransformPoints");
 
-    this->worldMatrix
-        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
+    if (points.size() != out.size())
+    {
+        OutputDebugFormat("Transform.TransformPoints : span sizes do not match.\n");
+        return false;
+    }
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
+    TransformSimd::TransformVectors(out.data(), points.data(), points.size(), this->GetWorldMatrix(), true);
+    return true;
 }
 
-void Transform::SetWorldScaleX(float x, bool bLocalUpdate)
+bool Transform::TransformPoints
+(
+    std::span<const float> x,    std::span<const float> y,    std::span<const float> z,
+    std::span<float>       outX, std::span<float>       outY, std::span<float>       outZ
+) const
 {
-    float mult = x / this->GetWorldScale().x;
+    TRANSFORM_TRACE_SCOPE("Transform.TransformPoints");
 
-    this->worldMatrix._11 *= mult;
-    this->worldMatrix._12 *= mult;
-    this->worldMatrix._13 *= mult;
+    const size_t count = x.size();
+    if (y.size() != count || z.size() != count || outX.size() != count || outY.size() != count || outZ.size() != count)
+    {
+        OutputDebugFormat("Transform.TransformPoints : span sizes do not match.\n");
+        return false;
+    }
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
+    TransformSimd::TransformVectorsSoA(outX.data(), outY.data(), outZ.data(), x.data(), y.data(), z.data(), count, this->GetWorldMatrix(), true);
+    return true;
 }
 
-void Transform::SetWorldScaleY(float y, bool bLocalUpdate)
+bool Transform::TransformDirections(std::span<const D3DXVECTOR3> directions, std::span<D3DXVECTOR3> out) const
 {
-    float mult = y / this->GetWorldScale().y;
+    TRANSFORM_TRACE_SCOPE("Transform.TransformDirections");
 
-    this->worldMatrix._21 *= mult;
-    this->worldMatrix._22 *= mult;
-    this->worldMatrix._23 *= mult;
+    if (directions.size() != out.size())
+    {
+        OutputDebugFormat("Transform.TransformDirections : span sizes do not match.\n");
+        return false;
+    }
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
+    TransformSimd::TransformVectors(out.data(), directions.data(), directions.size(), this->GetWorldMatrix(), false);
+    return true;
 }
 
-void Transform::SetWorldScaleZ(float z, bool bLocalUpdate)
+bool Transform::TransformDirections
+(
+    std::span<const float> x,    std::span<const float> y,    std::span<const float> z,
+    std::span<float>       outX, std::span<float>       outY, std::span<float>       outZ
+) const
 {
-    float mult = z / this->GetWorldScale().z;
+    TRANSFORM_TRACE_SCOPE("Transform.TransformDirections");
 
-    this->worldMatrix._31 *= mult;
-    this->worldMatrix._32 *= mult;
-    this->worldMatrix._33 *= mult;
+    const size_t count = x.size();
+    if (y.size() != count || z.size() != count || outX.size() != count || outY.size() != count || outZ.size() != count)
+    {
+        OutputDebugFormat("Transform.TransformDirections : span sizes do not match.\n");
+        return false;
+    }
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
+    TransformSimd::TransformVectorsSoA(outX.data(), outY.data(), outZ.data(), x.data(), y.data(), z.data(), count, this->GetWorldMatrix(), false);
+    return true;
 }
 
-/*** add ***/
-
-void Transform::AddWorldScale(const D3DXVECTOR3* const scale, bool bLocalUpdate)
+bool Transform::InverseTransformPoints(std::span<const D3DXVECTOR3> points, std::span<D3DXVECTOR3> out) const
 {
-    if (!scale) return;
-
-    D3DXVECTOR3 tempLocation   = this->GetWorldLocation();
-    D3DXVECTOR3 tempScale      = this->GetWorldScale() + *scale;
-    D3DXMATRIX  rotationMatrix = this->GetWorldRotationMatrix();
+    TRANSFORM_TRACE_SCOPE("Transform.InverseTransformPoints");
 
-    this->worldMatrix
-        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
+    if (points.size() != out.size())
+    {
+        OutputDebugFormat("Transform.InverseTransformPoints : span sizes do not match.\n");
+        return false;
+    }
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
+    TransformSimd::TransformVectors(out.data(), points.data(), points.size(), this->GetInverseWorldMatrix(), true);
+    return true;
 }
 
-void Transform::AddWorldScale(float x, float y, float z, bool bLocalUpdate)
+bool Transform::InverseTransformPoints
+(
+    std::span<const float> x,    std::span<const float> y,    std::span<const float> z,
+    std::span<float>       outX, std::span<float>       outY, std::span<float>       outZ
+) const
 {
-    D3DXVECTOR3 tempLocation   = this->GetWorldLocation();
-    D3DXVECTOR3 tempScale      = this->GetWorldScale() + D3DXVECTOR3(x, y, z);
-    D3DXMATRIX  scaleMatrix, rotationInverse;
-    D3DXMATRIX  rotationMatrix = this->GetWorldRotationMatrix();
-
-    //this->worldMatrix._41 = 0;
-    //this->worldMatrix._42 = 0;
-    //this->worldMatrix._43 = 0;
+    TRANSFORM_TRACE_SCOPE("Transform.InverseTransformPoints");
 
-    //D3DXMatrixInverse(&rotationInverse, nullptr, &rotationMatrix);
+    const size_t count = x.size();
+    if (y.size() != count || z.size() != count || outX.size() != count || outY.size() != count || outZ.size() != count)
+    {
+        OutputDebugFormat("Transform.InverseTransformPoints : span sizes do not match.\n");
+        return false;
+    }
 
-    //D3DXMatrixScaling(&scaleMatrix, x, y, z);
-    //this->worldMatrix = this->worldMatrix * rotationInverse * scaleMatrix * rotationMatrix;
+    TransformSimd::TransformVectorsSoA(outX.data(), outY.data(), outZ.data(), x.data(), y.data(), z.data(), count, this->GetInverseWorldMatrix(), true);
+    return true;
+}
 
-    //this->worldMatrix._41 = tempLocation.x;
-    //this->worldMatrix._42 = tempLocation.y;
-    //this->worldMatrix._43 = tempLocation.z;
 
-    this->worldMatrix
-        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
 
-    if(bLocalUpdate) this->UpdateLocalMatrix();
-}
 
-/***** local *****/
 
-/*** get ***/
+/**************************************** XV ****************************************/
 
-D3DXVECTOR3 Transform::GetLocalScale() const
+void Transform::UpdateWorldMatrix(bool bCallEventUpdated)
 {
-    D3DXVECTOR3 directions[3] =
-    {
-        {this->localMatrix._11, this->localMatrix._12, this->localMatrix._13},
-        {this->localMatrix._21, this->localMatrix._22, this->localMatrix._23},
-        {this->localMatrix._31, this->localMatrix._32, this->localMatrix._33}
-    };
+    // hNX localMatrix 𒼐ڕύXĂ邩Ȃ̂ŁAނ͒g
+    this->localMatrixClass = Transform::ClassifyMatrix(&this->localMatrix);
 
-    return D3DXVECTOR3
-    (
-        D3DXVec3Length(&directions[0]),
-        D3DXVec3Length(&directions[1]),
-        D3DXVec3Length(&directions[2])
-    );
-}
+    // ύXO̒l͕Ȃ̂Ŕł͕Ki߂ ( [Js̃LbVANH[^jI[h̕蒼 )
+    this->localVersion++;
 
-/*** set ***/
+    this->PropagateWorldMatrix(bCallEventUpdated);
+}
 
-void Transform::SetLocalScale(const D3DXVECTOR3* const scale, bool bWorldUpdate)
+void Transform::UpdateLocalMatrix(bool bCallEventUpdated)
 {
-    if (!scale) return;
-
-    D3DXVECTOR3 tempLocation   = this->GetLocalLocation();
-    D3DXMATRIX  rotationMatrix = this->GetLocalRotationMatrix();
+    // hNX worldMatrix 𒼐ڕύXĂ邩Ȃ̂ŁAނ͒g
+    this->worldMatrixClass = Transform::ClassifyMatrix(&this->worldMatrix);
 
-    this->localMatrix
-        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, scale);
+    // ύXO̒l͕Ȃ̂Ŕł͕Ki߂ ( tsȂǂ̃LbVAWorldMatrixStaging ȂǂɕύX` )
+    this->worldVersion++;
+    Transform::worldChangeCount.fetch_add(1, std::memory_order_relaxed);
 
-    if(bWorldUpdate) this->UpdateLocalMatrix();
+    this->PropagateLocalMatrix(bCallEventUpdated);
 }
 
-void Transform::SetLocalScale(float x, float y, float z, bool bWorldUpdate)
+void Transform::PropagateWorldMatrix(bool bCallEventUpdated)
 {
-    D3DXVECTOR3 tempLocation   = this->GetLocalLocation();
-    D3DXVECTOR3 tempScale      = { x, y, z };
-    D3DXMATRIX  rotationMatrix = this->GetLocalRotationMatrix();
+    TRANSFORM_TRACE_SCOPE("Transform.UpdateWorldMatrix");
 
-    this->localMatrix
-        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
+    // g̃[hsvZ
+    this->CalcWorldMatrix();
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
+    // qXV
+    this->UpdateDescendantsWorldMatrix();
+
+    // Cxg
+    if (bCallEventUpdated)
+        this->EventTransformUpdated();
 }
 
-void Transform::SetLocalScaleX(float x, bool bWorldUpdate)
+void Transform::PropagateLocalMatrix(bool bCallEventUpdated)
 {
-    float mult = x / this->GetLocalScale().x;
+    TRANSFORM_TRACE_SCOPE("Transform.UpdateLocalMatrix");
 
-    this->localMatrix._11 *= mult;
-    this->localMatrix._12 *= mult;
-    this->localMatrix._13 *= mult;
+    // g̃[JsvZ
+    this->CalcLocalMatrix();
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
+    // qXV ( ԈȂqɈt邾 )
+    if (this->bThrottled)
+    {
+        for (auto&& child : this->childrenTransforms) child->bWorldDirty = true;
+    }
+    else
+    {
+        this->UpdateDescendantsWorldMatrix();
+    }
+
+    // Cxg
+    if (bCallEventUpdated)
+        this->EventTransformUpdated();
 }
 
-void Transform::SetLocalScaleY(float y, bool bWorldUpdate)
+void Transform::SetUpdateThrottled(bool bThrottled)
 {
-    float mult = y / this->GetLocalScale().y;
+    // gƎq ( ċAȂ )
+    std::vector<Transform*> stack;
+    stack.push_back(this);
 
-    this->localMatrix._21 *= mult;
-    this->localMatrix._22 *= mult;
-    this->localMatrix._23 *= mult;
+    while (!stack.empty())
+    {
+        Transform* const node = stack.back();
+        stack.pop_back();
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
+        node->bThrottled = bThrottled;
+        stack.insert(stack.end(), node->childrenTransforms.begin(), node->childrenTransforms.end());
+    }
 }
 
-void Transform::SetLocalScaleZ(float z, bool bWorldUpdate)
+bool Transform::IsUpdateThrottled() const
 {
-    float mult = z / this->GetLocalScale().z;
+    return this->bThrottled;
+}
 
-    this->localMatrix._31 *= mult;
-    this->localMatrix._32 *= mult;
-    this->localMatrix._33 *= mult;
 
-    if(bWorldUpdate) this->UpdateWorldMatrix();
-}
 
-/*** add ***/
+/**************************************** ޕʂ̌vZ ****************************************/
 
-void Transform::AddLocalScale(const D3DXVECTOR3* const scale, bool bWorldUpdate)
+Transform::MatrixClass Transform::ClassifyScale(const D3DXVECTOR3* const scale)
 {
-    if (!scale) return;
+    if (!scale) return MatrixClass::Identity;
 
-    D3DXVECTOR3 tempLocation   = this->GetLocalLocation();
-    D3DXVECTOR3 tempScale      = this->GetLocalScale() + *scale;
-    D3DXMATRIX  rotationMatrix = this->GetLocalRotationMatrix();
+    const float epsilon = 1.0e-5f;
 
-    this->localMatrix
-        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
+    // ψłȂ
+    if (fabsf(scale->x - scale->y) > epsilon || fabsf(scale->x - scale->z) > epsilon) return MatrixClass::General;
 
-    if(bWorldUpdate) this->UpdateLocalMatrix();
+    return (fabsf(scale->x - 1.0f) > epsilon) ? MatrixClass::UniformScale : MatrixClass::Identity;
 }
 
-void Transform::AddLocalScale(float x, float y, float z, bool bWorldUpdate)
+Transform::MatrixClass Transform::ScaledClass(MatrixClass matrixClass, const D3DXVECTOR3* const scale)
 {
-    D3DXVECTOR3 tempLocation   = this->GetLocalLocation();
-    D3DXVECTOR3 tempScale      = this->GetLocalScale() + D3DXVECTOR3(x, y, z);
-    D3DXMATRIX  rotationMatrix = this->GetLocalRotationMatrix();
-
-    this->localMatrix
-        = Transform::CreateWorldTranslationMatrix(&tempLocation, &rotationMatrix, &tempScale);
+    // f܂ލs͊gkĂʂ̂܂
+    if (matrixClass == MatrixClass::General) return MatrixClass::General;
 
-    if(bWorldUpdate) this->UpdateLocalMatrix();
+    return std::max(matrixClass, Transform::ClassifyScale(scale));
 }
 
+void Transform::MultiplyByClass
+(
+    D3DXMATRIX*       const out,
+    const D3DXMATRIX&       a,
+    MatrixClass             aClass,
+    const D3DXMATRIX&       b,
+    MatrixClass             bClass
+)
+{
+    // PʍsȂ̂
+    if (bClass == MatrixClass::Identity) { *out = a; return; }
+    if (aClass == MatrixClass::Identity) { *out = b; return; }
 
-/****************************************  ****************************************/
+    // ˉe܂ނȂ
+    if (aClass == MatrixClass::General || bClass == MatrixClass::General)
+    {
+        D3DXMatrixMultiply(out, &a, &b);
+        return;
+    }
 
-D3DXVECTOR3 Transform::GetForwardVector() const
-{
-    D3DXVECTOR3 result
-    (
-        this->worldMatrix._31,
-        this->worldMatrix._32,
-        this->worldMatrix._33
-    );
+    // b sړ̂ : W̑Ẑ
+    if (bClass == MatrixClass::Translation)
+    {
+        *out = a;
+        out->_41 += b._41;
+        out->_42 += b._42;
+        out->_43 += b._43;
+        return;
+    }
 
-    D3DXVec3Normalize(&result, &result);
+    // a sړ̂ : a ̍W b ŕϊ̂
+    if (aClass == MatrixClass::Translation)
+    {
+        const float x = a._41,
+                    y = a._42,
+                    z = a._43;
+
+        *out = b;
+        out->_41 = x * b._11 + y * b._21 + z * b._31 + b._41;
+        out->_42 = x * b._12 + y * b._22 + z * b._32 + b._42;
+        out->_43 = x * b._13 + y * b._23 + z * b._33 + b._43;
+        return;
+    }
 
-    return result;
+    // ́Aψgk : 3x3 ƍŴ
+    D3DXMATRIX result;
+
+    result._11 = a._11 * b._11 + a._12 * b._21 + a._13 * b._31;
+    result._12 = a._11 * b._12 + a._12 * b._22 + a._13 * b._32;
+    result._13 = a._11 * b._13 + a._12 * b._23 + a._13 * b._33;
+    result._14 = 0.0f;
+    result._21 = a._21 * b._11 + a._22 * b._21 + a._23 * b._31;
+    result._22 = a._21 * b._12 + a._22 * b._22 + a._23 * b._32;
+    result._23 = a._21 * b._13 + a._22 * b._23 + a._23 * b._33;
+    result._24 = 0.0f;
+    result._31 = a._31 * b._11 + a._32 * b._21 + a._33 * b._31;
+    result._32 = a._31 * b._12 + a._32 * b._22 + a._33 * b._32;
+    result._33 = a._31 * b._13 + a._32 * b._23 + a._33 * b._33;
+    result._34 = 0.0f;
+    result._41 = a._41 * b._11 + a._42 * b._21 + a._43 * b._31 + b._41;
+    result._42 = a._41 * b._12 + a._42 * b._22 + a._43 * b._32 + b._42;
+    result._43 = a._41 * b._13 + a._42 * b._23 + a._43 * b._33 + b._43;
+    result._44 = 1.0f;
+
+    *out = result;
 }
 
-D3DXVECTOR3 Transform::GetUpVector() const
+void Transform::InverseByClass(D3DXMATRIX* const out, const D3DXMATRIX& matrix, MatrixClass matrixClass)
 {
-    D3DXVECTOR3 result
-    (
-        this->worldMatrix._21,
-        this->worldMatrix._22,
-        this->worldMatrix._23
-    );
+    switch (matrixClass)
+    {
+    case MatrixClass::Identity:
+        D3DXMatrixIdentity(out);
+        break;
+
+    case MatrixClass::Translation:
+        // W̕]̂
+        D3DXMatrixIdentity(out);
+        out->_41 = -matrix._41;
+        out->_42 = -matrix._42;
+        out->_43 = -matrix._43;
+        break;
+
+    case MatrixClass::Rigid:
+    case MatrixClass::UniformScale:
+    {
+        // 3x3 ͓]u ( ψgkȂ 1 / s^2 { )
+        const float scaleSq = (matrixClass == MatrixClass::Rigid)
+            ? 1.0f
+            : matrix._11 * matrix._11 + matrix._12 * matrix._12 + matrix._13 * matrix._13;
 
-    D3DXVec3Normalize(&result, &result);
+        // gk 0 ͋ts񂪖̂ŒPʍs
+        if (scaleSq == 0.0f)
+        {
+            D3DXMatrixIdentity(out);
+            break;
+        }
 
-    return result;
-}
+        const float invScaleSq = 1.0f / scaleSq;
 
-D3DXVECTOR3 Transform::GetRightVector() const
-{
-    D3DXVECTOR3 result
-    (
-        this->worldMatrix._11,
-        this->worldMatrix._12,
-        this->worldMatrix._13
-    );
+        D3DXMATRIX result;
 
-    D3DXVec3Normalize(&result, &result);
+        result._11 = matrix._11 * invScaleSq; result._12 = matrix._21 * invScaleSq; result._13 = matrix._31 * invScaleSq; result._14 = 0.0f;
+        result._21 = matrix._12 * invScaleSq; result._22 = matrix._22 * invScaleSq; result._23 = matrix._32 * invScaleSq; result._24 = 0.0f;
+        result._31 = matrix._13 * invScaleSq; result._32 = matrix._23 * invScaleSq; result._33 = matrix._33 * invScaleSq; result._34 = 0.0f;
 
-    return result;
+        result._41 = -(matrix._41 * result._11 + matrix._42 * result._21 + matrix._43 * result._31);
+        result._42 = -(matrix._41 * result._12 + matrix._42 * result._22 + matrix._43 * result._32);
+        result._43 = -(matrix._41 * result._13 + matrix._42 * result._23 + matrix._43 * result._33);
+        result._44 = 1.0f;
+
+        *out = result;
+        break;
+    }
+
+    default:
+        // ts񂪖ΒPʍs ( D3DXMatrixInverse() ͎s out ɏȂ )
+        if (!D3DXMatrixInverse(out, nullptr, &matrix)) D3DXMatrixIdentity(out);
+        break;
+    }
 }
 
-D3DXVECTOR3 Transform::GetLocalForwardVector() const
+Transform::ColdData& Transform::GetColdData() const
 {
-    D3DXVECTOR3 result
-    (
-        this->localMatrix._31,
-        this->localMatrix._32,
-        this->localMatrix._33
-    );
+    ColdData* cold = this->coldData.load(std::memory_order_acquire);
+    if (cold) return *cold;
 
-    D3DXVec3Normalize(&result, &result);
+    // Ɋmۂꂽɓꂽg
+    ColdData* const created = new ColdData();
+    if (this->coldData.compare_exchange_strong(cold, created, std::memory_order_acq_rel)) return *created;
 
-    return result;
+    delete created;
+    return *cold;
 }
 
-D3DXVECTOR3 Transform::GetLocalUpVector() const
+Transform::ColdData* Transform::FindColdData() const
 {
-    D3DXVECTOR3 result
-    (
-        this->localMatrix._21,
-        this->localMatrix._22,
-        this->localMatrix._23
-    );
-
-    D3DXVec3Normalize(&result, &result);
-
-    return result;
+    return this->coldData.load(std::memory_order_acquire);
 }
 
-D3DXVECTOR3 Transform::GetLocalRightVector() const
+void Transform::CalcBasis(Basis* const out, const D3DXMATRIX& matrix)
 {
-    D3DXVECTOR3 result
+    out->right   = D3DXVECTOR3(matrix._11, matrix._12, matrix._13);
+    out->up      = D3DXVECTOR3(matrix._21, matrix._22, matrix._23);
+    out->forward = D3DXVECTOR3(matrix._31, matrix._32, matrix._33);
+
+    // ނ̂ł]̐ςݏd˂Œ͂̂ŁAɊes̒𑪂 ( łƂɈxȂ̂ň )
+    const float right   = D3DXVec3Length(&out->right);
+    const float up      = D3DXVec3Length(&out->up);
+    const float forward = D3DXVec3Length(&out->forward);
+    out->inverseScale = D3DXVECTOR3
     (
-        this->localMatrix._11,
-        this->localMatrix._12,
-        this->localMatrix._13
+        (right   > 0.0f) ? 1.0f / right   : 0.0f,
+        (up      > 0.0f) ? 1.0f / up      : 0.0f,
+        (forward > 0.0f) ? 1.0f / forward : 0.0f
     );
 
-    D3DXVec3Normalize(&result, &result);
-
-    return result;
+    out->right   *= out->inverseScale.x;
+    out->up      *= out->inverseScale.y;
+    out->forward *= out->inverseScale.z;
 }
 
-
-
-
-
-/**************************************** XV ****************************************/
-
-void Transform::UpdateWorldMatrix(bool bCallEventUpdated)
+void Transform::CalcWorldMatrix()
 {
+    // ςƂł𑝂₷
+    const D3DXMATRIX before = this->worldMatrix;
+
     // eꍇ
     if (this->HasParent())
     {
-        D3DXMATRIX parentMatrix = this->parentTransform->GetWorldMatrix();
-
-        // es񂪒Pʍs̏ꍇ |ZȂ
-        D3DXMatrixIsIdentity(&parentMatrix)
-            ? this->worldMatrix = this->localMatrix
-            : this->worldMatrix = this->localMatrix * parentMatrix;
+        // ނɉĊ|Z ( ePʍsȂ̂ )
+        Transform::MultiplyByClass
+        (
+            &this->worldMatrix,
+            this->localMatrix,                   this->localMatrixClass,
+            this->parentTransform->worldMatrix, this->parentTransform->worldMatrixClass
+        );
+        this->worldMatrixClass = std::max(this->localMatrixClass, this->parentTransform->worldMatrixClass);
     }
     // eȂꍇ
     else
     {
-        this->worldMatrix = this->localMatrix;
+        this->worldMatrix      = this->localMatrix;
+        this->worldMatrixClass = this->localMatrixClass;
     }
 
-    // qXV
-    for (auto&& child : this->childrenTransforms)
+    this->bWorldDirty = false;
+
+    if (!Transform::IsSameMatrix(before, this->worldMatrix))
     {
-        child->UpdateWorldMatrix();
+        this->worldVersion++;
+        Transform::worldChangeCount.fetch_add(1, std::memory_order_relaxed);
     }
-
-    // Cxg
-    if (bCallEventUpdated)
-        this->EventTransformUpdated();
 }
 
-void Transform::UpdateLocalMatrix(bool bCallEventUpdated)
+void Transform::CalcLocalMatrix()
 {
+    // ςƂł𑝂₷
+    const D3DXMATRIX before = this->localMatrix;
+
     // eꍇ
     if (this->HasParent())
     {
-        D3DXMATRIX parentMatrix = this->parentTransform->GetWorldMatrix();
+        // Ԉ̐e͍ŐVɂĂ
+        this->parentTransform->GetWorldMatrix();
+
+        const MatrixClass parentClass = this->parentTransform->worldMatrixClass;
         
-        if (!D3DXMatrixIsIdentity(&parentMatrix))
+        if (parentClass != MatrixClass::Identity)
         {
-            D3DXMATRIX parentInverse;
+            // ނɉts ( sړȂ畄]ÂȂ]u )
+            // eɃLbV΂gA ColdData mۂɂ̏ŌvZ
+            const Transform* const parent = this->parentTransform;
+            const ColdData* const parentCold = parent->FindColdData();
+            const bool bCached = parentCold && parentCold->inverseWorldVersion.load(std::memory_order_acquire) == parent->worldVersion;
 
-            D3DXMatrixInverse(&parentInverse, nullptr, &this->parentTransform->GetWorldMatrix());
+            D3DXMATRIX parentInverse;
+            if (bCached) parentInverse = parentCold->inverseWorldMatrix;
+            else         Transform::InverseByClass(&parentInverse, parent->worldMatrix, parentClass);
 
-            this->localMatrix = this->worldMatrix * parentInverse;
+            Transform::MultiplyByClass
+            (
+                &this->localMatrix,
+                this->worldMatrix, this->worldMatrixClass,
+                parentInverse,     parentClass
+            );
         }
         // es񂪒PʍŝƂ
         else
         {
             this->localMatrix = this->worldMatrix;
         }
+
+        this->localMatrixClass = std::max(this->worldMatrixClass, parentClass);
     }
     // eȂꍇ
     else
     {
-        this->localMatrix = this->worldMatrix;
+        this->localMatrix      = this->worldMatrix;
+        this->localMatrixClass = this->worldMatrixClass;
+    }
+
+    this->bWorldDirty = false;
+
+    if (!Transform::IsSameMatrix(before, this->localMatrix)) this->localVersion++;
+}
+
+void Transform::UpdateDescendantsWorldMatrix()
+{
+    // t͉Ȃ
+    if (this->childrenTransforms.empty()) return;
+
+    // p̔z؂ ( CxgōXVĂȂ悤 move  )
+    thread_local std::vector<Transform*> buffer;
+    std::vector<Transform*> order = std::move(buffer);
+    order.clear();
+
+    // qς ( Ԉ̕؂Ƃ̋Eł͈tĎ~߂ )
+    auto pushChildren = [&order](const Transform* const node)
+    {
+        if (node->bThrottled)
+        {
+            order.insert(order.end(), node->childrenTransforms.begin(), node->childrenTransforms.end());
+            return;
+        }
+
+        for (auto&& child : node->childrenTransforms)
+        {
+            if (child->bThrottled) child->bWorldDirty = true;
+            else                   order.push_back(child);
+        }
+    };
+
+    TRANSFORM_TRACE_SCOPE("Transform.Propagate");
+
+    // Kw ( D ) ɕׂȂvZ ( e͕KqɌvZAX^bN͏Ȃ )
+    pushChildren(this);
+
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        Transform* const node = order[i];
+
+        node->CalcWorldMatrix();
+        pushChildren(node);
     }
 
-    // qXV
-    for (auto&& child : this->childrenTransforms)
+    // Cxg ( [Aq͐e )
     {
-        child->UpdateWorldMatrix();
+        TRANSFORM_TRACE_SCOPE("Transform.Events");
+
+        for (size_t i = order.size(); i-- > 0;)
+        {
+            order[i]->EventTransformUpdated();
+        }
     }
 
-    // Cxg
-    if (bCallEventUpdated)
-        this->EventTransformUpdated();
+    buffer = std::move(order);
+}
+
+void Transform::WorldMatrixChanged(const D3DXMATRIX& before, MatrixClass matrixClass, bool bLocalUpdate)
+{
+    // lςƂł𑝂₷
+    if (!Transform::IsSameMatrix(before, this->worldMatrix))
+    {
+        this->worldMatrixClass = matrixClass;
+        this->worldVersion++;
+        Transform::worldChangeCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // [Js͒lłvZ ( O bLocalUpdate = false ŏ܂fĂȂȂ )
+    if (bLocalUpdate) this->PropagateLocalMatrix();
+}
+
+void Transform::LocalMatrixChanged(const D3DXMATRIX& before, MatrixClass matrixClass, bool bWorldUpdate)
+{
+    // lςĂȂΔł͑₳Ȃ ( f̕ύXcĂΔfACxg͕ςƂƓ )
+    if (Transform::IsSameMatrix(before, this->localMatrix))
+    {
+        if (bWorldUpdate && !this->bThrottled)
+        {
+            if (this->bWorldDirty) this->PropagateWorldMatrix();
+            else                   this->EventTransformUpdated();
+        }
+        return;
+    }
+
+    this->localMatrixClass = matrixClass;
+    this->localVersion++;
+
+    // fȂꍇAԈ̏ꍇ͈tĂ ( ComputeWorldMatrixNow() Ŏg )
+    if (bWorldUpdate && !this->bThrottled) this->PropagateWorldMatrix();
+    else                                   this->bWorldDirty = true;
+}
+
+bool Transform::IsSameMatrix(const D3DXMATRIX& a, const D3DXMATRIX& b)
+{
+    return std::memcmp(&a, &b, sizeof(D3DXMATRIX)) == 0;
 }
\ No newline at end of file
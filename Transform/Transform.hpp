@@ -1,8 +1,17 @@
 #include <vector>
+#include <span>
+#include <memory>
+#include <atomic>
 #include <d3dx9.h>
 #include "utils.hpp"
+#include "InlineVector.hpp"
 #pragma once
 
+// qg̒Ɏ ( ƃq[vA64bit  2 Ȃ 1 m[h 192 byte Ɏ܂A1 ₷Ƃ 8 byte  )
+#ifndef TRANSFORM_INLINE_CHILD_CAPACITY
+#define TRANSFORM_INLINE_CHILD_CAPACITY 2
+#endif
+
 struct Rotation
 {
 	float yaw,
@@ -374,6 +383,45 @@ struct Rotation
 
 class Transform
 {
+public:
+	/// <summary>
+	/// s̕ ( ɍsقǈʓIAvZd )
+	/// ނ͏EŁAۂ̍s񂪂PłȂ
+	/// </summary>
+	enum class MatrixClass : unsigned char
+	{
+		Identity,		// Pʍs
+		Translation,	// sړ̂
+		Rigid,			// ] + sړ
+		UniformScale,	// ψgk + ] + sړ
+		General,		// ȊO
+	};
+
+	/// <summary>
+	/// KxNgƁAẽXP[̋t ( GetBasis(), GetLocalBasis() )
+	/// </summary>
+	struct Basis
+	{
+		D3DXVECTOR3 right;			// x direction
+		D3DXVECTOR3 up;				// y direction
+		D3DXVECTOR3 forward;		// z direction
+		D3DXVECTOR3 inverseScale;	// es̒̋t (  0 Ȃ 0 )
+	};
+
+	/// <summary>
+	/// GetRelativeMatrix() ̌ʂĂяoŊoĂ ( g𖈃t[₢킹ꍇ )
+	/// Ŕr͎Ȃ̂ŁAXbhƂɎ
+	/// </summary>
+	struct RelativeMatrixCache
+	{
+		D3DXMATRIX       matrix;
+		const Transform* from          = nullptr;
+		const Transform* to            = nullptr;
+		unsigned int     pathVersion   = 0;	// oH̃[Js̔ł̘a
+		unsigned int     topologyEpoch = 0;
+		bool             bValid        = false;
+	};
+
 public:
 	/***** ctor, dtor *****/
 
@@ -395,7 +443,8 @@ public:
 		const D3DXMATRIX* const localMatrix
 	);
 
-	~Transform();
+	// eO ( O(1) )Aq̓[hsێ܂ܐeɂ
+	virtual ~Transform();
 
 
 public:
@@ -408,7 +457,7 @@ public:
 	void SetParent(Transform* const parent);
 
 	// q擾
-	const std::vector<Transform*>& GetChildren() const;
+	std::span<Transform* const> GetChildren() const;
 
 	// eqɂȂ ( parent = nullptr Őeq )
 	void BecomeParents(Transform* const parent);
@@ -419,7 +468,7 @@ public:
 	// qǉ
 	bool AddChild(Transform* const child);
 
-	// q
+	// q ( ̌Zl߂̂ŏԂ͕ۂAj ( fXgN^ADestroySubtree() ) ł͍Ō̎q󂢂ʒuɈڂ )
 	bool RemoveChild(Transform* const child);
 
 	// c ancestor ݂邩
@@ -431,12 +480,152 @@ public:
 	// qĂ邩
 	bool HasChild();
 
+	/// <summary>
+	///  Transform ܂Ƃ߂ newParent ̎qɂ
+	/// ( z`FbNAe̋tsvZ͈xA؂̍XVx )
+	/// </summary>
+	/// <param name="transforms">	eύX Transform B </param>
+	/// <param name="newParent">	Ve ( nullptr Őeq ) </param>
+	/// <param name="bKeepWorld">	[hsێ邩 (ftHg true) </param>
+	/// <returns> eύX </returns>
+	static size_t ReparentMany
+	(
+		std::span<Transform* const> transforms,
+		Transform* const            newParent,
+		bool                        bKeepWorld = true
+	);
+
+	/// <summary>
+	/// `d ( UpdateWorldMatrix() ) ׂ؂̍W߂
+	/// e Transform ɂāAgƐĉutransforms Ɋ܂܂vuf̈󂪂vԏƂ ( dAq͖ )
+	/// ύXŃ[hs̖f̈󂪏O ( ComputeWorldMatrixNow() Ȃǂ̑O ) ɌĂԂ
+	/// </summary>
+	/// <param name="transforms">	ύX (  ) Transform B </param>
+	/// <param name="roots">		؂̍ ( ㏑ ) </param>
+	static void CollectUpdateRoots(std::span<Transform* const> transforms, std::vector<Transform*>* const roots);
+
+	/// <summary>
+	/// SĂ̎qƂ̐eqxɉ
+	/// </summary>
+	/// <param name="bKeepWorld"> q̃[hsێ邩 ( true Ȃq̍ČvZ͖ ) </param>
+	/// <returns> q̐ </returns>
+	size_t DetachAllChildren(bool bKeepWorld = true);
+
+	/// <summary>
+	///  ( root Ǝq ) ܂Ƃ߂Ĕj
+	/// ɕ؂̒̐eqSĐ؂ĂAq珇 deleter Ă ( efXgN^͐eq̉Ȃ )
+	/// </summary>
+	/// <param name="root">		؂̍ ( e O(1) ŊO ) </param>
+	/// <param name="deleter">	j֐ ( Transform* 󂯎 ) </param>
+	/// <returns> j </returns>
+	template<class Deleter>
+	static size_t DestroySubtree(Transform* const root, Deleter deleter)
+	{
+		std::vector<Transform*> nodes;
+		Transform::UnlinkSubtree(root, &nodes);
+
+		for (size_t i = nodes.size(); i-- > 0;) deleter(nodes[i]);
+
+		return nodes.size();
+	}
+
+	// ؂܂Ƃ߂Ĕj ( new ō Transform p )
+	static size_t DestroySubtree(Transform* const root);
+
+	/// <summary>
+	/// e̔ԍ̔z񂩂Kw܂Ƃ߂đgݗĂ ( z`FbN͈xAq̔z͐ɊmہA[hs͈x̑ŌvZ )
+	/// transforms[i] ̐e transforms[parentIndices[i]] ( -1 Ȃ獡̐ê܂ )
+	/// e̔ԍ Transform ͐eł邱 ( ΂ Transform z )
+	/// -1  Transform ͍̐c transforms ̑ Transform Ă悢 ( ̐cɌvZAgݗĂʂzƂs )
+	/// sƂ͉ύXȂ
+	/// </summary>
+	/// <param name="transforms">		gݗĂ Transform B </param>
+	/// <param name="parentIndices">	e̔ԍ ( transforms Ɠ ) </param>
+	/// <param name="localMatrices">	[Js ( transforms Ɠ ) </param>
+	/// <returns>  </returns>
+	static bool BuildHierarchy
+	(
+		std::span<Transform* const> transforms,
+		std::span<const int>        parentIndices,
+		std::span<const D3DXMATRIX> localMatrices
+	);
+
+	/// <summary>
+	/// e̔ԍ̔z񂩂Kw܂Ƃ߂đgݗĂ ( WA]Agk )
+	/// </summary>
+	/// <param name="transforms">		gݗĂ Transform B </param>
+	/// <param name="parentIndices">	e̔ԍ ( -1 Ȃ獡̐ê܂ ) </param>
+	/// <param name="locations">		W </param>
+	/// <param name="rotations">		] </param>
+	/// <param name="scales">			gk </param>
+	/// <returns>  </returns>
+	static bool BuildHierarchy
+	(
+		std::span<Transform* const>  transforms,
+		std::span<const int>         parentIndices,
+		std::span<const D3DXVECTOR3> locations,
+		std::span<const Rotation>    rotations,
+		std::span<const D3DXVECTOR3> scales
+	);
+
 public:
 	/***** matrix *****/
 
-	// [hs擾
+	// [hs擾 ( ԈȂ疢f̕ύXŌvZA[hs񂩂擾͑Sē )
 	const D3DXMATRIX& GetWorldMatrix()  const;
 
+	/// <summary>
+	/// c̖f̕ύX ( bWorldUpdate = false ) ܂߂[hsvZ
+	/// ԏ̖XV̐c玩g܂ł̌oHvZăLbVAoHǑZ͌vZȂ
+	/// ( Z͖XV̈󂪕t̂ŁAŐc UpdateWorldMatrix() ĂԂƁBCxg͔Ȃ )
+	/// </summary>
+	/// <returns> ŐṼ[hs </returns>
+	const D3DXMATRIX& ComputeWorldMatrixNow();
+
+	// [hs񂪖XV ( g̈̂݁Ac͌Ȃ )
+	bool IsWorldMatrixDirty() const;
+
+	// [hs̔ ( lςƂAO̒lƔׂΕύXołBUpdateLocalMatrix() ł͕K )
+	unsigned int GetWorldVersion() const;
+
+	// [Js̔ ( lςƂBUpdateWorldMatrix() ł͕K )
+	unsigned int GetLocalVersion() const;
+
+	// t[̋؂i߂ ( t[AAvŌĂ )
+	static void AdvanceFrameEpoch();
+
+	// ̃t[̋؂
+	static unsigned int GetFrameEpoch();
+
+	// SĂ Transform ̃[hs񂪕ς ( OƓȂAǂ̃[hsςĂȂ )
+	static unsigned int GetWorldChangeCount();
+
+	/// <summary>
+	/// [hs̋ts擾 ( [hs̔łƂɈxAނɉĈԈ@ŌvZ )
+	/// ts񂪖 ( gk 0 Ȃ ) Ƃ͒Pʍs
+	/// </summary>
+	/// <returns> [hs̋ts </returns>
+	const D3DXMATRIX& GetInverseWorldMatrix() const;
+
+	/// <summary>
+	/// @p̍s擾 ( [hs 3x3 ̋t]uAsړ 0 )
+	/// [hs̔łƂɈxvZ ( ̂Ȃ]̂܂܁AψgkȂ 1 / s^2 {Ats񂪖ΒPʍs )
+	/// </summary>
+	/// <returns> @p̍s </returns>
+	const D3DXMATRIX& GetNormalMatrix() const;
+
+	/// <summary>
+	/// from ̋Ԃ to ̋Ԃֈڂs擾 ( from ̃[hs * to ̃[hts )
+	/// ʂ̐c牺̃[Js񂾂|̂ŁA[hsoR덷 ( tsނɉČvZ )
+	/// c̖f̕ύX ( bWorldUpdate = false ) ܂߂ČvZ
+	/// cache nƁAoH̃[JsƐeqςĂȂΊoʂԂ ( ʂ̐cオĂvZȂ )
+	/// </summary>
+	/// <param name="from">	ϊ ( nullptr Ń[h ) </param>
+	/// <param name="to">	ϊ ( nullptr Ń[h ) </param>
+	/// <param name="cache">	ĂяoŎLbV ( nullptr ŖvZ ) </param>
+	/// <returns> from ̋Ԃ to ̋Ԃւ̍s </returns>
+	static D3DXMATRIX GetRelativeMatrix(const Transform* const from, const Transform* const to, RelativeMatrixCache* const cache = nullptr);
+
 	// [hsZbgA[JsXV
 	void SetWorldMatrix(const D3DXMATRIX* const worldMatrix);
 	
@@ -446,6 +635,15 @@ public:
 	// [JsZbgA[hsXV
 	void SetLocalMatrix(const D3DXMATRIX* const localMatrix);
 
+	// [hs̕ނ擾
+	MatrixClass GetWorldMatrixClass() const;
+
+	// [Js̕ނ擾
+	MatrixClass GetLocalMatrixClass() const;
+
+	// s̒g番ނ𔻒 ( evf𒲂ׂ̂ōXVł͎gȂ )
+	static MatrixClass ClassifyMatrix(const D3DXMATRIX* const matrix);
+
 	// [h]s擾
 	D3DXMATRIX GetWorldRotationMatrix() const;
 
@@ -749,6 +947,20 @@ public:
 	/// <param name="bWorldUpdate">	[hsXV邩 (ftHg true) </param>
 	void SetLocalQuaternion(const D3DXQUATERNION* quat, bool bWorldUpdate = true);
 
+	/*** quaternion mode ***/
+
+	/// <summary>
+	/// [J̉]PʃNH[^jIŎ ( ]ςݏd˂Ăs̊ꂪȂ )
+	/// LȊԁAAdd*Rotation()  *RotateAroundAxis() ̓NH[^jI̐ςƊȈՂȐKŉ]ς݁A[Js蒼
+	/// ( world ł͐eψgkȉŁA[JsXVƂBȊO͍sŌvZ )
+	/// ق̕@Ń[Js񂪕ςẢ]̂Ƃɍs񂩂番 ( f܂ލsɂ͎gȂ )
+	/// </summary>
+	/// <param name="bEnable"> Lɂ邩 </param>
+	void SetQuaternionRotationMode(bool bEnable);
+
+	// [J̉]NH[^jIŎĂ邩
+	bool IsQuaternionRotationMode() const;
+
 
 public:
 	/***** scale *****/
@@ -883,15 +1095,82 @@ public:
 	// x direction ( local )
 	D3DXVECTOR3 GetLocalRightVector() const;
 
+	/// <summary>
+	/// [hs̐K܂Ƃ߂Ď擾 ( [hs̔łƂɈxvZ )
+	/// </summary>
+	/// <returns>  ( right, up, forward, inverseScale ) </returns>
+	const Basis& GetBasis() const;
+
+	/// <summary>
+	/// [Js̐K܂Ƃ߂Ď擾 ( [Js̔łƂɈxvZ )
+	/// </summary>
+	/// <returns>  ( right, up, forward, inverseScale ) </returns>
+	const Basis& GetLocalBasis() const;
+
+public:
+	/***** ꊇϊ *****/
+	//
+	// ʂ̍WA[hs ( ts ) ł܂Ƃ߂ĕϊ ( SSEAAVX2 Ύg )
+	// out  in Ɠł悢Az̐ȂΉ false
+	// AoS  D3DXVECTOR3 ̔zASoA  x, y, z ʁX̔z ( SIMD ̕ł܂Ƃ߂ČvZł̂ő )
+	//
+
+	// W[hԂ ( D3DXVec3TransformCoord Ɠ )
+	bool TransformPoints(std::span<const D3DXVECTOR3> points, std::span<D3DXVECTOR3> out) const;
+	bool TransformPoints
+	(
+		std::span<const float> x,    std::span<const float> y,    std::span<const float> z,
+		std::span<float>       outX, std::span<float>       outY, std::span<float>       outZ
+	) const;
+
+	// [hԂ ( D3DXVec3TransformNormal ƓAsړȂAKȂ )
+	bool TransformDirections(std::span<const D3DXVECTOR3> directions, std::span<D3DXVECTOR3> out) const;
+	bool TransformDirections
+	(
+		std::span<const float> x,    std::span<const float> y,    std::span<const float> z,
+		std::span<float>       outX, std::span<float>       outY, std::span<float>       outZ
+	) const;
+
+	// [hԂ̍Wg̋Ԃ ( ts GetInverseWorldMatrix() ̃LbV )
+	bool InverseTransformPoints(std::span<const D3DXVECTOR3> points, std::span<D3DXVECTOR3> out) const;
+	bool InverseTransformPoints
+	(
+		std::span<const float> x,    std::span<const float> y,    std::span<const float> z,
+		std::span<float>       outX, std::span<float>       outY, std::span<float>       outZ
+	) const;
+
 public:
 	/****** matrix updater *****/
 
-	// [hsXV
+	// [hsXV ( localMatrix 𒼐ڕύXɌĂԁAlocalMatrixClass ͍s̒g画肵A[Js̔łi߂ )
 	void UpdateWorldMatrix(bool bCallEventUpdated = true);
 
-	// [JsXV
+	// [JsXV ( worldMatrix 𒼐ڕύXɌĂԁAworldMatrixClass ͍s̒g画肵A[hs̔łi߂ )
 	void UpdateLocalMatrix(bool bCallEventUpdated = true);
 
+	/// <summary>
+	/// XVԈ ( gƎqɐݒATransformScheduler g )
+	/// Ԉ̕؂͕ύXĂ`df̈󂾂tAc̓`dEŎ~܂
+	/// ( XPW[[̏ԁAUpdateWorldMatrix()A[hsǂގ擾 ( GetWorldMatrix()AGetWorldLocation()AGetBasis() Ȃ ) ŌvZ )
+	/// Ԉ Transform ɒǉqԈɂȂA؂OƉ ( ݒ肵g͂̂܂ )
+	/// </summary>
+	/// <param name="bThrottled"> Ԉ </param>
+	void SetUpdateThrottled(bool bThrottled);
+
+	// XVԈĂ邩
+	bool IsUpdateThrottled() const;
+
+
+	/*
+	 * o̔zu
+	 * `d ( CalcWorldMatrix / UpdateDescendantsWorldMatrix ) ŐĜ擪l߂ĒuA
+	 * ߂ɎgȂLbV ColdData ɕāA߂ĎgƂɊmۂ
+	 * ( LbVg const ̎擾́A Transform ɕXbh瓯ɌĂł悢BύXƂ͓ɌĂ΂Ȃ
+	 *   Ԉ Transform ́A[hsǂގ擾f̕ύXvZďނ̂ŁAɌĂ΂Ȃ )
+	 * 
+	 * 1 m[h̗\Z ( 64bit ) : vptr 8 + s 128 + ށEEŁEq̈ʒu 16 + e 8 + q 24 ( 2 ܂ŒɎ ) + ColdData 8 = 192 byte
+	 * 3 LbVC ( 192 byte ) 𒴂Ȃ ( Transform.cpp  static_assert ŊmFATRANSFORM_INLINE_CHILD_CAPACITY  2 葝₵ 1  8 byte ܂ő )
+	 */
 
 protected:
 	// worldMatrix 𒼐ڕύXAUpdateLocalMatrix() ĂԂ
@@ -900,18 +1179,179 @@ protected:
 	// localMatrix 𒼐ڕύXAUpdateWorldMatrix() ĂԂ
 	D3DXMATRIX localMatrix;
 
+	// worldMatrix ̕ ( UpdateLocalMatrix() Ŕ肵 )
+	MatrixClass worldMatrixClass;
+
+	// localMatrix ̕ ( UpdateWorldMatrix() Ŕ肵 )
+	MatrixClass localMatrixClass;
+
 
 private:
 
-	// q
-	std::vector<Transform*> childrenTransforms;
+	// [Js̕ύX[hs ( gƎq ) ɖf
+	bool bWorldDirty;
+
+	// XVԈĂ ( SetUpdateThrottled() )
+	bool bThrottled;
+
+	// [hs̔ ( GetWorldVersion() )
+	unsigned int worldVersion;
+
+	// [Js̔ ( GetLocalVersion() )
+	unsigned int localVersion;
+
+	// e childrenTransforms ł̈ʒu ( e O(1) ŊO߁AeȂΕs )
+	unsigned int childIndex;
+
+	// ȉ̑Ŝ͕̐ʃXbh̍XV ( ؂Ƃ̕ȓ`dȂ ) 瓯ɑ̂ atomic ( ͗vȂ̂ relaxed )
+
+	// t[̋؂ ( GetFrameEpoch() )
+	static std::atomic<unsigned int> frameEpoch;
+
+	// Ŝ̃[hs̕ύX ( GetWorldChangeCount() )
+	static std::atomic<unsigned int> worldChangeCount;
+
+	// eq̕tւAjAւő ( GetRelativeMatrix() ̃LbVʂ̌oH⓯ʒu̕ʂ̃m[hƎႦȂ悤 )
+	static std::atomic<unsigned int> topologyEpoch;
 
 	// e
 	Transform* parentTransform;
 
+	// q ( Ȃ΃q[vgȂ )
+	InlineVector<Transform*, TRANSFORM_INLINE_CHILD_CAPACITY> childrenTransforms;
+
+	// ߂ɎgȂf[^ ( tsȂǂ̃LbVAg Transform.cpp )
+	struct ColdData;
+
+	// ߂ĎgƂɊm ( GetColdData()Aconst ̎擾瓯ɊmۂĂc悤 atomic )
+	mutable std::atomic<ColdData*> coldData;
+
+	// ColdData 擾 ( Ίm )
+	ColdData& GetColdData() const;
+
+	// ColdData 擾 (  nullptrAmۂȂ )
+	ColdData* FindColdData() const;
+
+
+private:
+	/***** ޕʂ̌vZ *****/
+
+	// XP[番ނ𔻒 ( (1,1,1) Ȃ Identity )
+	static MatrixClass ClassifyScale(const D3DXVECTOR3* const scale);
+
+	// sgk̕
+	static MatrixClass ScaledClass(MatrixClass matrixClass, const D3DXVECTOR3* const scale);
+
+	// out = a * b ( ނɉĈԈvZI )
+	static void MultiplyByClass
+	(
+		D3DXMATRIX*       const out,
+		const D3DXMATRIX&       a,
+		MatrixClass             aClass,
+		const D3DXMATRIX&       b,
+		MatrixClass             bClass
+	);
+
+	// ts ( ނɉĈԈvZIԁAgk 0 Ȃǂŋts񂪖ΒPʍs )
+	static void InverseByClass(D3DXMATRIX* const out, const D3DXMATRIX& matrix, MatrixClass matrixClass);
+
+	// [JsƐe烏[hsvZ ( ĝ )
+	void CalcWorldMatrix();
+
+	// [hsƐe烍[JsvZ ( ĝ݁Aq͍XVȂ )
+	void CalcLocalMatrix();
+
+	// gƎq̃[hsXV ( ނ͂̂܂܎gAZb^[Ɠ`dp )
+	void PropagateWorldMatrix(bool bCallEventUpdated = true);
+
+	// g̃[JsƎq̃[hsXV ( ނ͂̂܂܎gAZb^[Ɠ`dp )
+	void PropagateLocalMatrix(bool bCallEventUpdated = true);
+
+	// ̐eqtƃ[hšvZ ( Vm[h͐cɂȂ蓾Ȃ̂ŏz`FbNAts͕sv )
+	void InitializeHierarchy(Transform* const parent);
+
+	// gݗĂ̖{ ( classes Ȃs񂩂番ނ𔻒 )
+	static bool BuildHierarchyImpl
+	(
+		std::span<Transform* const>  transforms,
+		std::span<const int>         parentIndices,
+		std::span<const D3DXMATRIX>  localMatrices,
+		std::span<const MatrixClass> classes
+	);
+
+	// e̎q̔z̖ɉ ( z`FbNAs̍XV͂Ȃ )
+	void LinkToParent(Transform* const parent);
+
+	// ԈȂ疢f̕ύXvZ ( [hsǂ const ̎擾͑SĂʂ )
+	void RefreshWorldMatrix() const;
+
+	// e̎q̔z񂩂O ( ̌Zl߂ďԂۂAs̍XV͂Ȃ )
+	void UnlinkFromParent();
+
+	// e̎q̔z񂩂 O(1) ŊO ( Ō̎q󂢂ʒuɈڂAjꍇg )
+	void UnlinkFromParentUnordered();
+
+	// e̎q̔z̊oʒuɎ邩 ( SetParent() ŐewĂꍇ false )
+	bool IsLinkedToParent() const;
+
+	// q̔z nullptr l߂ ( Ԃ͕ۂAReparentMany() ŐeƂɈx )
+	void CompactChildren();
+
+	// Ԉe󂯌pł邩 ( eςOɒׂ )
+	bool IsThrottleInherited() const;
+
+	// eςɊԈeɍ킹 ( 󂯌płԈ trueAq̔f͌Ăяo )
+	bool FollowParentThrottled(bool bInherited);
+
+	// ؂eOA̐eqSĐ؂ĊKwɏW߂ ( DestroySubtree() )
+	static void UnlinkSubtree(Transform* const root, std::vector<Transform*>* const nodes);
+
+	// q̃[hsXV ( ċAKwɑACxg͎qɔ )
+	void UpdateDescendantsWorldMatrix();
+
+	// [hsɌĂ ( ނZbgAKvȂ烍[JsXV )
+	// lȂł͑₳ȂA[JšvZ EventTransformUpdated() ͕ςƂƓs
+	void WorldMatrixChanged(const D3DXMATRIX& before, MatrixClass matrixClass, bool bLocalUpdate);
+
+	// NH[^jI[hŃ[J̉] delta ς ( ς񂾌̉]烍[Js蒼 )
+	void AccumulateLocalQuaternion(const D3DXQUATERNION& delta, bool bWorldUpdate);
+
+	// NH[^jI[h̃[h̉][J̉]ɒ ( eψgkȉłȂAgk 0 Ȃ falseAẻ] GetBasis() ̃LbV )
+	bool WorldToLocalRotationDelta(D3DXQUATERNION* const delta) const;
+
+	// [JsɌĂ ( ނZbgAKvȂ烏[hsXV )
+	// lȂł͑₳ȂAEventTransformUpdated() ͕ςƂƓ
+	void LocalMatrixChanged(const D3DXMATRIX& before, MatrixClass matrixClass, bool bWorldUpdate);
+
+	// s񂪑S ( rbgr )
+	static bool IsSameMatrix(const D3DXMATRIX& a, const D3DXMATRIX& b);
+
 
 private:
 
+	// ܂Ƃ߂ēKpƂɓ̌vZ ( CalcLocalMatrix() Ȃ ) g
+	friend class TransformCommandBuffer;
+
+	// ؂̓`d ( PropagateWorldMatrix() ) g
+	friend class TransformScheduler;
+	friend class AimConstraintSolver;
+
+	// m[h̓ւ ( SwapNodes() ) g
+	friend class TransformArena;
+
+	// ev[gƃCX^X̍švZɕޕʂ̊|Z ( MultiplyByClass() ) g
+	friend class TransformPrefab;
+	friend class TransformPrefabInstance;
+
+	/// <summary>
+	/// 2 ̃m[h̒gւAeq̃|C^tւ ( ̈ʒu )
+	/// sAŁALbVꏏɈړACxg͔Ȃ
+	/// </summary>
+	static void SwapNodes(Transform* const a, Transform* const b);
+
+	// vZ
+	static void CalcBasis(Basis* const out, const D3DXMATRIX& matrix);
+
 	// s񂪍XVꂽƂɌĂ΂
 	virtual void EventTransformUpdated() {};
 
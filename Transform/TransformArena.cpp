@@ -0,0 +1,224 @@
+#include "TransformArena.hpp"
+#include "TransformTrace.hpp"
+#include <new>
+
+TransformArena::TransformArena(size_t capacity)
+{
+    this->capacity         = capacity;
+    this->defragmentCursor = 0;
+
+    // SĂ̈ʒu Transform \zĂ ( j蒼 )
+    this->nodes = static_cast<Transform*>(::operator new(sizeof(Transform) * capacity, std::align_val_t(alignof(Transform))));
+    for (size_t i = 0; i < capacity; i++) new (&this->nodes[i]) Transform();
+
+    this->slotOfId.resize(capacity);
+    this->generationOfId.assign(capacity, 1);
+    this->idOfSlot.resize(capacity);
+    this->aliveIds.assign(capacity, false);
+
+    // 擪g悤tɐς
+    this->freeIds.reserve(capacity);
+    for (size_t i = capacity; i-- > 0;)
+    {
+        this->slotOfId[i] = static_cast<unsigned int>(i);
+        this->idOfSlot[i] = static_cast<unsigned int>(i);
+        this->freeIds.push_back(static_cast<unsigned int>(i));
+    }
+}
+
+TransformArena::~TransformArena()
+{
+    // eq͑SăA[i̒Ȃ̂ŁAɑSĐ؂Ăj ( fXgN^ŉ̏Ȃ )
+    for (size_t i = 0; i < this->capacity; i++)
+    {
+        this->nodes[i].parentTransform = nullptr;
+        this->nodes[i].childrenTransforms.clear();
+    }
+    for (size_t i = 0; i < this->capacity; i++) this->nodes[i].~Transform();
+
+    ::operator delete(this->nodes, std::align_val_t(alignof(Transform)));
+}
+
+/**************************************** 쐬Aj ****************************************/
+
+TransformHandle TransformArena::Create(TransformHandle parent, const D3DXMATRIX* const localMatrix)
+{
+    if (this->freeIds.empty())
+    {
+        OutputDebugFormat("TransformArena.Create : arena is full.\n");
+        return TransformArena::InvalidHandle;
+    }
+
+    Transform* const parentNode = this->Get(parent);
+    if (parent != TransformArena::InvalidHandle && !parentNode)
+    {
+        OutputDebugFormat("TransformArena.Create : parent handle is stale.\n");
+        return TransformArena::InvalidHandle;
+    }
+
+    const unsigned int id = this->freeIds.back();
+    this->freeIds.pop_back();
+    this->aliveIds[id] = true;
+
+    Transform* const node = this->Slot(this->slotOfId[id]);
+    if (localMatrix) node->SetLocalMatrix(localMatrix);
+    if (parentNode)  parentNode->AddChild(node), node->PropagateWorldMatrix();
+
+    return { id, this->generationOfId[id] };
+}
+
+bool TransformArena::Destroy(TransformHandle handle)
+{
+    Transform* const node = this->Get(handle);
+    if (!node) return false;
+
+    // q̓[hsێ܂ܐe
+    while (node->HasChild())
+    {
+        node->GetChildren().back()->BreakParents();
+    }
+    node->BreakParents();
+
+    // ʒuԂɍ蒼
+    node->~Transform();
+    new (node) Transform();
+
+    this->aliveIds[handle.id] = false;
+    this->generationOfId[handle.id]++;
+    if (this->generationOfId[handle.id] == 0) this->generationOfId[handle.id] = 1;
+    this->freeIds.push_back(handle.id);
+
+    return true;
+}
+
+Transform* TransformArena::Get(TransformHandle handle) const
+{
+    if (handle.id >= this->capacity)                          return nullptr;
+    if (!this->aliveIds[handle.id])                           return nullptr;
+    if (this->generationOfId[handle.id] != handle.generation) return nullptr;
+
+    return this->Slot(this->slotOfId[handle.id]);
+}
+
+size_t TransformArena::GetCount() const
+{
+    return this->capacity - this->freeIds.size();
+}
+
+size_t TransformArena::GetCapacity() const
+{
+    return this->capacity;
+}
+
+
+
+/**************************************** בւ ****************************************/
+
+bool TransformArena::DefragmentStep(size_t maxMoves)
+{
+    TRANSFORM_TRACE_SCOPE("TransformArena.DefragmentStep");
+
+    // ̎n߂ɕя
+    if (this->defragmentCursor == 0 || this->defragmentCursor > this->defragmentOrder.size())
+    {
+        this->BuildOrder(&this->defragmentOrder);
+        this->defragmentCursor = 0;
+    }
+
+    size_t moves = 0;
+    while (this->defragmentCursor < this->defragmentOrder.size())
+    {
+        const unsigned int slot = static_cast<unsigned int>(this->defragmentCursor);
+        const unsigned int id   = this->defragmentOrder[this->defragmentCursor];
+
+        // rŔjꂽm[h͔΂ ( ̈ʒu͋󂫂̂܂ )
+        if (this->aliveIds[id] && this->slotOfId[id] != slot)
+        {
+            if (moves >= maxMoves) return false;
+
+            this->SwapSlots(slot, this->slotOfId[id]);
+            moves++;
+        }
+
+        this->defragmentCursor++;
+    }
+
+    this->defragmentCursor = 0;
+    return true;
+}
+
+void TransformArena::Defragment()
+{
+    this->defragmentCursor = 0;
+    while (!this->DefragmentStep(this->capacity)) {}
+}
+
+bool TransformArena::IsDefragmented() const
+{
+    std::vector<unsigned int> order;
+    this->BuildOrder(&order);
+
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        if (this->slotOfId[order[i]] != i) return false;
+    }
+    return true;
+}
+
+
+
+/****************************************  ****************************************/
+
+void TransformArena::SwapSlots(unsigned int slotA, unsigned int slotB)
+{
+    Transform::SwapNodes(this->Slot(slotA), this->Slot(slotB));
+
+    const unsigned int idA = this->idOfSlot[slotA];
+    const unsigned int idB = this->idOfSlot[slotB];
+
+    this->idOfSlot[slotA] = idB;
+    this->idOfSlot[slotB] = idA;
+    this->slotOfId[idA]   = slotB;
+    this->slotOfId[idB]   = slotA;
+}
+
+void TransformArena::BuildOrder(std::vector<unsigned int>* const order) const
+{
+    order->clear();
+    order->reserve(this->GetCount());
+
+    const Transform* const begin = this->nodes;
+    const Transform* const end   = this->nodes + this->capacity;
+    auto isInArena = [begin, end](const Transform* node) { return node >= begin && node < end; };
+
+    //  ( eȂ or eA[i̊O ) [D ( s )ÄʒȕɍH
+    std::vector<Transform*> stack;
+    for (unsigned int slot = 0; slot < this->capacity; slot++)
+    {
+        const unsigned int id = this->idOfSlot[slot];
+        if (!this->aliveIds[id]) continue;
+
+        Transform* const root = this->Slot(slot);
+        if (root->GetParent() && isInArena(root->GetParent())) continue;
+
+        stack.push_back(root);
+        while (!stack.empty())
+        {
+            Transform* const node = stack.back();
+            stack.pop_back();
+
+            order->push_back(this->idOfSlot[static_cast<unsigned int>(node - this->nodes)]);
+
+            const auto children = node->GetChildren();
+            for (auto it = children.rbegin(); it != children.rend(); ++it)
+            {
+                if (isInArena(*it)) stack.push_back(*it);
+            }
+        }
+    }
+}
+
+Transform* TransformArena::Slot(unsigned int slot) const
+{
+    return &this->nodes[slot];
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include <vector>
+#include "Transform.hpp"
+#pragma once
+
+/// <summary>
+/// TransformArena ̃m[hwnh ( m[hړĂςȂ )
+/// </summary>
+struct TransformHandle
+{
+	unsigned int id;
+	unsigned int generation;	// jꂽm[h̃nh ( 0 ͖ )
+
+	bool operator == (const TransformHandle& rh) const { return this->id == rh.id && this->generation == rh.generation; }
+	bool operator != (const TransformHandle& rh) const { return !(*this == rh); }
+};
+
+/// <summary>
+/// Transform AɎAnhő݂o
+/// DefragmentStep() ŏm[h[D̏ɕבւA؂ŘA悤ɂ
+/// 
+/// eʂ͍쐬ɌŒ ( L΂ƑSm[hړ邽 )
+/// Get() œ|C^͎ DefragmentStep() / Destroy() ܂ŗLAꍇ̓nhg
+/// ( |C^ێ WorldMatrixStaging Ȃǂɂ́Aבւ̌ɓo^ )
+/// A[ĩm[h̐eq̓A[i̒őgނ ( O̐em[h͍ƂĈ )
+/// </summary>
+class TransformArena
+{
+public:
+	// ȃnh
+	static constexpr TransformHandle InvalidHandle = { ~0u, 0 };
+
+public:
+	/***** ctor, dtor *****/
+	TransformArena(size_t capacity);
+	~TransformArena();
+
+	TransformArena(const TransformArena&)            = delete;
+	TransformArena& operator=(const TransformArena&) = delete;
+
+public:
+	/***** 쐬Aj *****/
+
+	/// <summary>
+	/// m[h쐬
+	/// </summary>
+	/// <param name="parent">		e ( InvalidHandle Őe ) </param>
+	/// <param name="localMatrix">	[Js ( nullptr ŒPʍs ) </param>
+	/// <returns> nh ( eʂȂ InvalidHandle ) </returns>
+	TransformHandle Create(TransformHandle parent = InvalidHandle, const D3DXMATRIX* const localMatrix = nullptr);
+
+	// m[hj ( eOAq̓[hsێ܂ܐeɂ )
+	bool Destroy(TransformHandle handle);
+
+	// nhm[h擾 ( jς݂Ȃ nullptr )
+	Transform* Get(TransformHandle handle) const;
+
+	// Ăm[h̐
+	size_t GetCount() const;
+
+	// e
+	size_t GetCapacity() const;
+
+public:
+	/***** בւ *****/
+
+	/// <summary>
+	/// [D̏ɕבւi߂ ( Ԃ؂Ėt[Ăׂ )
+	/// IƎ̌Ăяoŕя蒼
+	/// </summary>
+	/// <param name="maxMoves"> ̃Xebvœւő吔 </param>
+	/// <returns> בւI </returns>
+	bool DefragmentStep(size_t maxMoves);
+
+	// Ō܂ŕבւ
+	void Defragment();
+
+	// Ăm[h[D̏ɐ擪l܂Ă邩
+	bool IsDefragmented() const;
+
+private:
+	// 2 ̈ʒũm[hւ ( nhtւ )
+	void SwapSlots(unsigned int slotA, unsigned int slotB);
+
+	// [D̏ ( nh id ) 
+	void BuildOrder(std::vector<unsigned int>* const order) const;
+
+	// ʒũm[h
+	Transform* Slot(unsigned int slot) const;
+
+private:
+	// m[h ( AASĂ̈ʒu Transform \zĂ )
+	Transform* nodes;
+	size_t     capacity;
+
+	// id -> ʒu, 
+	std::vector<unsigned int> slotOfId;
+	std::vector<unsigned int> generationOfId;
+
+	// ʒu -> id
+	std::vector<unsigned int> idOfSlot;
+
+	// Ă邩 ( id  )
+	std::vector<bool> aliveIds;
+
+	// 󂢂Ă id
+	std::vector<unsigned int> freeIds;
+
+	// בւ̓ro
+	std::vector<unsigned int> defragmentOrder;
+	size_t                    defragmentCursor;
+};
\ No newline at end of file
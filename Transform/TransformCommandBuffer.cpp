@@ -0,0 +1,363 @@
+#include "TransformCommandBuffer.hpp"
+#include "TransformTrace.hpp"
+#include <atomic>
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    // CX^X̎ʔԍ ( 0 ͎gȂ )
+    std::atomic<unsigned long long> nextId = 1;
+}
+
+TransformCommandBuffer::TransformCommandBuffer() : id(nextId++)
+{
+}
+
+TransformCommandBuffer::~TransformCommandBuffer()
+{
+}
+
+/**************************************** L^ ****************************************/
+
+void TransformCommandBuffer::SetLocation(Transform* const target, const D3DXVECTOR3& location, Space space)
+{
+    this->Record(target, Kind::SetLocation, space, &location.x, 3);
+}
+
+void TransformCommandBuffer::AddLocation(Transform* const target, const D3DXVECTOR3& location, Space space)
+{
+    this->Record(target, Kind::AddLocation, space, &location.x, 3);
+}
+
+void TransformCommandBuffer::SetRotation(Transform* const target, const Rotation& rotation, Space space)
+{
+    const float values[3] = { rotation.yaw, rotation.pitch, rotation.roll };
+    this->Record(target, Kind::SetRotation, space, values, 3);
+}
+
+void TransformCommandBuffer::AddRotation(Transform* const target, const Rotation& rotation, Space space)
+{
+    const float values[3] = { rotation.yaw, rotation.pitch, rotation.roll };
+    this->Record(target, Kind::AddRotation, space, values, 3);
+}
+
+void TransformCommandBuffer::SetQuaternion(Transform* const target, const D3DXQUATERNION& quat, Space space)
+{
+    this->Record(target, Kind::SetQuaternion, space, &quat.x, 4);
+}
+
+void TransformCommandBuffer::SetScale(Transform* const target, const D3DXVECTOR3& scale, Space space)
+{
+    this->Record(target, Kind::SetScale, space, &scale.x, 3);
+}
+
+void TransformCommandBuffer::AddScale(Transform* const target, const D3DXVECTOR3& scale, Space space)
+{
+    this->Record(target, Kind::AddScale, space, &scale.x, 3);
+}
+
+void TransformCommandBuffer::SetMatrix(Transform* const target, const D3DXMATRIX& matrix, Space space)
+{
+    this->Record(target, Kind::SetMatrix, space, &matrix._11, 16);
+}
+
+void TransformCommandBuffer::Reparent(Transform* const target, Transform* const newParent, bool bKeepWorld)
+{
+    if (!target) return;
+
+    Command command = {};
+    command.target     = target;
+    command.newParent  = newParent;
+    command.kind       = Kind::Reparent;
+    command.space      = Space::World;
+    command.bKeepWorld = bKeepWorld;
+
+    this->GetThreadBuffer()->commands.push_back(command);
+}
+
+
+
+/**************************************** Kp ****************************************/
+
+size_t TransformCommandBuffer::Apply()
+{
+    TRANSFORM_TRACE_SCOPE("TransformCommandBuffer.Apply");
+
+    // SXbh̃obt@W߂
+    this->commands.clear();
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        for (auto&& [threadId, buffer] : this->threadBuffers)
+        {
+            this->commands.insert(this->commands.end(), buffer->commands.begin(), buffer->commands.end());
+            buffer->commands.clear();
+        }
+    }
+
+    if (this->commands.empty()) return 0;
+
+    size_t applied = 0;
+
+    // eqύX ( L^Aeւ̘AύX ReparentMany ňx )
+    std::vector<Command>    edits;
+    std::vector<Transform*> moving;
+    edits.reserve(this->commands.size());
+
+    for (size_t i = 0; i < this->commands.size();)
+    {
+        const Command& command = this->commands[i];
+
+        if (command.kind != Kind::Reparent)
+        {
+            edits.push_back(command);
+            i++;
+            continue;
+        }
+
+        moving.clear();
+        size_t next = i;
+        while (next < this->commands.size()
+            && this->commands[next].kind       == Kind::Reparent
+            && this->commands[next].newParent  == command.newParent
+            && this->commands[next].bKeepWorld == command.bKeepWorld)
+        {
+            moving.push_back(this->commands[next].target);
+            next++;
+        }
+
+        Transform::ReparentMany(moving, command.newParent, command.bKeepWorld);
+        applied += moving.size();
+        i = next;
+    }
+
+    if (edits.empty()) return applied;
+
+    // [߂ ( Transform ƂɈx )
+    std::unordered_map<Transform*, size_t> depths;
+    depths.reserve(edits.size());
+
+    for (const Command& command : edits)
+    {
+        auto [it, inserted] = depths.try_emplace(command.target, 0);
+        if (!inserted) continue;
+
+        size_t depth = 0;
+        for (Transform* parent = command.target->parentTransform; parent; parent = parent->parentTransform) depth++;
+        it->second = depth;
+    }
+
+    // 󂢏 (  Transform ̒ł͋L^ )
+    std::stable_sort
+    (
+        edits.begin(),
+        edits.end(),
+        [&depths](const Command& a, const Command& b)
+        {
+            const size_t depthA = depths[a.target];
+            const size_t depthB = depths[b.target];
+            if (depthA != depthB) return depthA < depthB;
+            return std::less<Transform*>()(a.target, b.target);
+        }
+    );
+
+    //  Transform ւ̖ʂȏ݂܂Ƃ߂
+    size_t count = 0;
+    for (size_t i = 0; i < edits.size(); i++)
+    {
+        const Command& command = edits[i];
+
+        // s̃Zbg͂܂ł̕ύXSď㏑
+        if (command.kind == Kind::SetMatrix)
+        {
+            while (count > 0 && edits[count - 1].target == command.target) count--;
+        }
+        else if (count > 0 && edits[count - 1].target == command.target)
+        {
+            if (TransformCommandBuffer::Merge(&edits[count - 1], command)) continue;
+        }
+
+        edits[count++] = command;
+    }
+    edits.resize(count);
+
+    // `d镔؂̍T ( sŖf̈󂪏O )
+    std::vector<Transform*> targets;
+    targets.reserve(depths.size());
+    for (auto&& [target, depth] : depths) targets.push_back(target);
+
+    std::vector<Transform*> roots;
+    Transform::CollectUpdateRoots(targets, &roots);
+
+    // ύXs ( `d͂Ȃ )
+    for (const Command& command : edits)
+    {
+        TransformCommandBuffer::Execute(command);
+    }
+    applied += edits.size();
+
+    // ؂ƂɈx`d
+    for (Transform* const root : roots)
+    {
+        root->PropagateWorldMatrix();
+    }
+
+    return applied;
+}
+
+void TransformCommandBuffer::Clear()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    for (auto&& [threadId, buffer] : this->threadBuffers)
+    {
+        buffer->commands.clear();
+    }
+}
+
+size_t TransformCommandBuffer::GetCommandCount()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    size_t count = 0;
+    for (auto&& [threadId, buffer] : this->threadBuffers)
+    {
+        count += buffer->commands.size();
+    }
+    return count;
+}
+
+
+
+/****************************************  ****************************************/
+
+TransformCommandBuffer::ThreadBuffer* TransformCommandBuffer::GetThreadBuffer()
+{
+    // OɎgobt@ ( Xbh )
+    thread_local unsigned long long cachedId     = 0;
+    thread_local ThreadBuffer*      cachedBuffer = nullptr;
+
+    if (cachedId == this->id) return cachedBuffer;
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    std::unique_ptr<ThreadBuffer>& buffer = this->threadBuffers[std::this_thread::get_id()];
+    if (!buffer) buffer = std::make_unique<ThreadBuffer>();
+
+    cachedId     = this->id;
+    cachedBuffer = buffer.get();
+
+    return cachedBuffer;
+}
+
+void TransformCommandBuffer::Record(Transform* const target, Kind kind, Space space, const float* values, size_t count)
+{
+    if (!target) return;
+
+    Command command = {};
+    command.target = target;
+    command.kind   = kind;
+    command.space  = space;
+    std::memcpy(command.values, values, count * sizeof(float));
+
+    this->GetThreadBuffer()->commands.push_back(command);
+}
+
+bool TransformCommandBuffer::Merge(Command* const last, const Command& command)
+{
+    if (last->space != command.space) return false;
+
+    switch (command.kind)
+    {
+    // Zbg͓vfւ̂܂ł̕ύX㏑
+    case Kind::SetLocation:
+        if (last->kind != Kind::SetLocation && last->kind != Kind::AddLocation) return false;
+        *last = command;
+        return true;
+
+    case Kind::SetScale:
+        if (last->kind != Kind::SetScale && last->kind != Kind::AddScale) return false;
+        *last = command;
+        return true;
+
+    case Kind::SetRotation:
+    case Kind::SetQuaternion:
+        if (last->kind != Kind::SetRotation && last->kind != Kind::AddRotation && last->kind != Kind::SetQuaternion) return false;
+        *last = command;
+        return true;
+
+    // WAXP[̉Z͑킹 ( ]̉Z͏ԂŌʂς̂ł܂Ƃ߂Ȃ )
+    case Kind::AddLocation:
+        if (last->kind != Kind::SetLocation && last->kind != Kind::AddLocation) return false;
+        for (int i = 0; i < 3; i++) last->values[i] += command.values[i];
+        return true;
+
+    case Kind::AddScale:
+        if (last->kind != Kind::SetScale && last->kind != Kind::AddScale) return false;
+        for (int i = 0; i < 3; i++) last->values[i] += command.values[i];
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+void TransformCommandBuffer::Execute(const Command& command)
+{
+    Transform* const target = command.target;
+    const float*     v      = command.values;
+
+    // [J̓[hs𔽉fɏ ( f̈󂪕t )
+    if (command.space == Space::Local)
+    {
+        switch (command.kind)
+        {
+        case Kind::SetLocation:   target->SetLocalLocation(v[0], v[1], v[2], false);                break;
+        case Kind::AddLocation:   target->AddLocalLocation(v[0], v[1], v[2], false);                break;
+        case Kind::SetRotation:   target->SetLocalRotation(v[0], v[1], v[2], false);                break;
+        case Kind::AddRotation:   target->AddLocalRotation(v[0], v[1], v[2], false);                break;
+        case Kind::SetQuaternion: target->SetLocalQuaternion(v[0], v[1], v[2], v[3], false);        break;
+        case Kind::SetScale:      target->SetLocalScale(v[0], v[1], v[2], false);                   break;
+        case Kind::AddScale:      target->AddLocalScale(v[0], v[1], v[2], false);                   break;
+        case Kind::SetMatrix:
+        {
+            const D3DXMATRIX matrix(v);
+            const D3DXMATRIX before = target->localMatrix;
+            target->localMatrix = matrix;
+            target->LocalMatrixChanged(before, Transform::ClassifyMatrix(&matrix), false);
+            break;
+        }
+        default: break;
+        }
+        return;
+    }
+
+    // [h͐c̕ύX܂߂̃[hsɑ΂ďA[Js񂾂vZ
+    target->ComputeWorldMatrixNow();
+
+    switch (command.kind)
+    {
+    case Kind::SetLocation:   target->SetWorldLocation(v[0], v[1], v[2], false);         break;
+    case Kind::AddLocation:   target->AddWorldLocation(v[0], v[1], v[2], false);         break;
+    case Kind::SetRotation:   target->SetWorldRotation(v[0], v[1], v[2], false);         break;
+    case Kind::AddRotation:   target->AddWorldRotation(v[0], v[1], v[2], false);         break;
+    case Kind::SetQuaternion: target->SetWorldQuaternion(v[0], v[1], v[2], v[3], false); break;
+    case Kind::SetScale:      target->SetWorldScale(v[0], v[1], v[2], false);            break;
+    case Kind::AddScale:      target->AddWorldScale(v[0], v[1], v[2], false);            break;
+    case Kind::SetMatrix:
+    {
+        const D3DXMATRIX matrix(v);
+        const D3DXMATRIX before = target->worldMatrix;
+        target->worldMatrix = matrix;
+        target->WorldMatrixChanged(before, Transform::ClassifyMatrix(&matrix), false);
+        break;
+    }
+    default: break;
+    }
+
+    target->CalcLocalMatrix();
+
+    // q͖vZȂ̂ňt
+    target->bWorldDirty = true;
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <d3dx9.h>
+#include "Transform.hpp"
+#pragma once
+
+/// <summary>
+/// Transform ̕ύXL^āACXbhł܂Ƃ߂ēKp
+/// L^͊eXbh̃obt@ɐςނȂ̂ŁAǂ̃XbhĂł悢 ( Ԃł̓bNȂ )
+/// Apply() ͐eqύXɍsAcKw̐󂢏ɕׁA Transform ւ̖ʂȏ݂܂Ƃ߂Ă
+/// ύXꂽ؂ƂɈx[hs`d
+/// 
+/// Apply() ͋L^ƓɌĂ΂Ȃ ( [J[̏I҂ĂĂ )
+/// L^ Transform  Apply() OɔjȂ
+///  Transform ւ̕ʃXbh̕ύX̏Ԃ͌܂Ȃ
+/// </summary>
+class TransformCommandBuffer
+{
+public:
+	// Wn
+	enum class Space : unsigned char
+	{
+		World,
+		Local,
+	};
+
+public:
+	/***** ctor, dtor *****/
+	TransformCommandBuffer();
+	~TransformCommandBuffer();
+
+	TransformCommandBuffer(const TransformCommandBuffer&)            = delete;
+	TransformCommandBuffer& operator=(const TransformCommandBuffer&) = delete;
+
+public:
+	/***** L^ *****/
+
+	// WZbg
+	void SetLocation(Transform* const target, const D3DXVECTOR3& location, Space space = Space::Local);
+
+	// WɉZ
+	void AddLocation(Transform* const target, const D3DXVECTOR3& location, Space space = Space::Local);
+
+	// ]Zbg
+	void SetRotation(Transform* const target, const Rotation& rotation, Space space = Space::Local);
+
+	// ]ɉZ
+	void AddRotation(Transform* const target, const Rotation& rotation, Space space = Space::Local);
+
+	// ]NH[^jIŃZbg
+	void SetQuaternion(Transform* const target, const D3DXQUATERNION& quat, Space space = Space::Local);
+
+	// XP[Zbg
+	void SetScale(Transform* const target, const D3DXVECTOR3& scale, Space space = Space::Local);
+
+	// XP[ɉZ
+	void AddScale(Transform* const target, const D3DXVECTOR3& scale, Space space = Space::Local);
+
+	// sZbg
+	void SetMatrix(Transform* const target, const D3DXMATRIX& matrix, Space space = Space::Local);
+
+	/// <summary>
+	/// eύX ( Apply() ł͑̕ύXɍs )
+	/// </summary>
+	/// <param name="target">		eύX Transform </param>
+	/// <param name="newParent">	Ve ( nullptr Őeq ) </param>
+	/// <param name="bKeepWorld">	[hsێ邩 (ftHg true) </param>
+	void Reparent(Transform* const target, Transform* const newParent, bool bKeepWorld = true);
+
+public:
+	/***** Kp *****/
+
+	/// <summary>
+	/// L^ύX܂Ƃ߂ēKp ( CXbhŌĂ )
+	/// </summary>
+	/// <returns> KpύX̐ ( ܂Ƃ߂ ) </returns>
+	size_t Apply();
+
+	// L^ύX̂Ă
+	void Clear();
+
+	// L^ĂύX̐
+	size_t GetCommandCount();
+
+private:
+	// ύX̎
+	enum class Kind : unsigned char
+	{
+		SetLocation,
+		AddLocation,
+		SetRotation,
+		AddRotation,
+		SetQuaternion,
+		SetScale,
+		AddScale,
+		SetMatrix,
+		Reparent,
+	};
+
+	// L^ 1 
+	struct Command
+	{
+		Transform* target;
+		Transform* newParent;	// Reparent ̂
+		Kind       kind;
+		Space      space;
+		bool       bKeepWorld;	// Reparent ̂
+		float      values[16];	// ނɉl ( WA]AsȂ )
+	};
+
+	// XbhƂ̃obt@
+	struct ThreadBuffer
+	{
+		std::vector<Command> commands;
+	};
+
+private:
+	// Ă񂾃Xbh̃obt@擾 ( ̂݃bN )
+	ThreadBuffer* GetThreadBuffer();
+
+	// L^
+	void Record(Transform* const target, Kind kind, Space space, const float* values, size_t count);
+
+	//  Transform ւ̕ύX܂Ƃ߂ ( ܂Ƃ߂ꂽ true )
+	static bool Merge(Command* const last, const Command& command);
+
+	// ύX 1 s ( [hs͓`dȂ )
+	static void Execute(const Command& command);
+
+private:
+	// CX^X̎ʔԍ ( XbhƂ̃LbVpAAhX̍ėp΍ )
+	const unsigned long long id;
+
+	// XbhƂ̃obt@
+	std::mutex mutex;
+	std::unordered_map<std::thread::id, std::unique_ptr<ThreadBuffer>> threadBuffers;
+
+	// Apply() Ŏg
+	std::vector<Command> commands;
+};
\ No newline at end of file
@@ -0,0 +1,505 @@
+#include "TransformPrefab.hpp"
+#include "TransformTrace.hpp"
+#include "TransformSimd.hpp"
+#include <algorithm>
+
+/**************************************** 쐬 ****************************************/
+
+std::shared_ptr<const TransformPrefab> TransformPrefab::Create
+(
+    std::span<const int>        parentIndices,
+    std::span<const D3DXMATRIX> localMatrices
+)
+{
+    return TransformPrefab::CreateImpl(parentIndices, localMatrices, {});
+}
+
+std::shared_ptr<const TransformPrefab> TransformPrefab::CreateFromSubtree(const Transform* const root)
+{
+    if (!root)
+    {
+        OutputDebugFormat("TransformPrefab.CreateFromSubtree : root is nullptr.\n");
+        return nullptr;
+    }
+
+    // KwɏW߂ ( e̔ԍ͏W߂ʒu )
+    std::vector<const Transform*>       nodes         = { root };
+    std::vector<int>                    parentIndices = { -1 };
+    std::vector<D3DXMATRIX>             localMatrices;
+    std::vector<Transform::MatrixClass> classes;
+
+    for (size_t head = 0; head < nodes.size(); head++)
+    {
+        for (const Transform* const child : nodes[head]->GetChildren())
+        {
+            nodes.push_back(child);
+            parentIndices.push_back(static_cast<int>(head));
+        }
+    }
+
+    localMatrices.reserve(nodes.size());
+    classes.reserve(nodes.size());
+    for (const Transform* const node : nodes)
+    {
+        localMatrices.push_back(node->GetLocalMatrix());
+        classes.push_back(node->GetLocalMatrixClass());
+    }
+
+    return TransformPrefab::CreateImpl(parentIndices, localMatrices, classes);
+}
+
+std::shared_ptr<const TransformPrefab> TransformPrefab::CreateImpl
+(
+    std::span<const int>                    parentIndices,
+    std::span<const D3DXMATRIX>             localMatrices,
+    std::span<const Transform::MatrixClass> classes
+)
+{
+    TRANSFORM_TRACE_SCOPE("TransformPrefab.Create");
+
+    const size_t count = parentIndices.size();
+    if (localMatrices.size() != count)
+    {
+        OutputDebugFormat("TransformPrefab.Create : array sizes do not match.\n");
+        return nullptr;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const int parentIndex = parentIndices[i];
+        if (parentIndex < -1 || parentIndex >= static_cast<int>(count) || parentIndex == static_cast<int>(i))
+        {
+            OutputDebugFormat("TransformPrefab.Create : parent index out of range.\n");
+            return nullptr;
+        }
+    }
+
+    // q̐𐔂āAq̔ԍeƂɋl߂ ( v\[g )
+    std::vector<size_t> childBegin(count + 1, 0);
+    for (size_t i = 0; i < count; i++)
+    {
+        if (parentIndices[i] >= 0) childBegin[parentIndices[i] + 1]++;
+    }
+    for (size_t i = 0; i < count; i++) childBegin[i + 1] += childBegin[i];
+
+    std::vector<unsigned int> childIndices(childBegin[count]);
+    {
+        std::vector<size_t> cursor(childBegin.begin(), childBegin.end() - 1);
+        for (size_t i = 0; i < count; i++)
+        {
+            if (parentIndices[i] >= 0) childIndices[cursor[parentIndices[i]]++] = static_cast<unsigned int>(i);
+        }
+    }
+
+    // make_shared  private ̃RXgN^ĂׂȂ
+    std::shared_ptr<TransformPrefab> prefab(new TransformPrefab());
+
+    // Kwɕׂ ( HȂm[hΏzĂ )
+    std::vector<unsigned int>& order = prefab->order;
+    order.reserve(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (parentIndices[i] < 0) order.push_back(static_cast<unsigned int>(i));
+    }
+    for (size_t head = 0; head < order.size(); head++)
+    {
+        const unsigned int node = order[head];
+        order.insert(order.end(), childIndices.begin() + childBegin[node], childIndices.begin() + childBegin[node + 1]);
+    }
+
+    if (order.size() != count)
+    {
+        OutputDebugFormat("TransformPrefab.Create : hierarchy has a cycle.\n");
+        return nullptr;
+    }
+
+    prefab->parentIndices.assign(parentIndices.begin(), parentIndices.end());
+    prefab->localMatrices.assign(localMatrices.begin(), localMatrices.end());
+
+    if (classes.empty())
+    {
+        prefab->localClasses.resize(count);
+        for (size_t i = 0; i < count; i++) prefab->localClasses[i] = Transform::ClassifyMatrix(&localMatrices[i]);
+    }
+    else
+    {
+        prefab->localClasses.assign(classes.begin(), classes.end());
+    }
+
+    // 猩s ( SẴCX^XŋL镔x| )
+    prefab->relativeMatrices.resize(count);
+    prefab->relativeClasses.resize(count);
+
+    for (const unsigned int node : order)
+    {
+        const int parentIndex = parentIndices[node];
+        if (parentIndex < 0)
+        {
+            prefab->relativeMatrices[node] = prefab->localMatrices[node];
+            prefab->relativeClasses[node]  = prefab->localClasses[node];
+            continue;
+        }
+
+        Transform::MultiplyByClass
+        (
+            &prefab->relativeMatrices[node],
+            prefab->localMatrices[node],           prefab->localClasses[node],
+            prefab->relativeMatrices[parentIndex], prefab->relativeClasses[parentIndex]
+        );
+        prefab->relativeClasses[node] = std::max(prefab->localClasses[node], prefab->relativeClasses[parentIndex]);
+    }
+
+    return prefab;
+}
+
+
+
+/**************************************** 擾 ****************************************/
+
+size_t TransformPrefab::GetNodeCount() const
+{
+    return this->parentIndices.size();
+}
+
+std::span<const int> TransformPrefab::GetParentIndices() const
+{
+    return this->parentIndices;
+}
+
+std::span<const D3DXMATRIX> TransformPrefab::GetLocalMatrices() const
+{
+    return this->localMatrices;
+}
+
+std::span<const Transform::MatrixClass> TransformPrefab::GetLocalMatrixClasses() const
+{
+    return this->localClasses;
+}
+
+std::span<const unsigned int> TransformPrefab::GetOrder() const
+{
+    return this->order;
+}
+
+std::span<const D3DXMATRIX> TransformPrefab::GetRelativeMatrices() const
+{
+    return this->relativeMatrices;
+}
+
+std::span<const Transform::MatrixClass> TransformPrefab::GetRelativeMatrixClasses() const
+{
+    return this->relativeClasses;
+}
+
+
+
+/**************************************** CX^X ****************************************/
+
+bool TransformPrefab::EvaluateInstances
+(
+    std::span<const D3DXMATRIX> instanceRoots,
+    std::span<D3DXMATRIX>       out,
+    bool                        bByNode
+) const
+{
+    TRANSFORM_TRACE_SCOPE("TransformPrefab.EvaluateInstances");
+
+    const size_t nodeCount     = this->relativeMatrices.size();
+    const size_t instanceCount = instanceRoots.size();
+    if (out.size() < nodeCount * instanceCount)
+    {
+        OutputDebugFormat("TransformPrefab.EvaluateInstances : output is too small.\n");
+        return false;
+    }
+
+    // CX^XƂɍ̍sxǂݍ݁ASm[hɊ|
+    for (size_t i = 0; i < instanceCount; i++)
+    {
+        if (bByNode) TransformSimd::MultiplyMatrices(&out[i],             instanceCount, this->relativeMatrices.data(), nodeCount, instanceRoots[i]);
+        else         TransformSimd::MultiplyMatrices(&out[i * nodeCount], 1,             this->relativeMatrices.data(), nodeCount, instanceRoots[i]);
+    }
+
+    return true;
+}
+
+bool TransformPrefab::EvaluateInstances4x3
+(
+    std::span<const D3DXMATRIX> instanceRoots,
+    std::span<float>            out,
+    bool                        bByNode
+) const
+{
+    TRANSFORM_TRACE_SCOPE("TransformPrefab.EvaluateInstances4x3");
+
+    const size_t nodeCount     = this->relativeMatrices.size();
+    const size_t instanceCount = instanceRoots.size();
+    if (out.size() < nodeCount * instanceCount * 12)
+    {
+        OutputDebugFormat("TransformPrefab.EvaluateInstances4x3 : output is too small.\n");
+        return false;
+    }
+
+    for (size_t i = 0; i < instanceCount; i++)
+    {
+        if (bByNode) TransformSimd::MultiplyMatrices4x3(&out[i * 12],             instanceCount * 12, this->relativeMatrices.data(), nodeCount, instanceRoots[i]);
+        else         TransformSimd::MultiplyMatrices4x3(&out[i * nodeCount * 12], 12,                 this->relativeMatrices.data(), nodeCount, instanceRoots[i]);
+    }
+
+    return true;
+}
+
+
+
+/**************************************** TransformPrefabInstance ****************************************/
+
+TransformPrefabInstance::TransformPrefabInstance(std::shared_ptr<const TransformPrefab> prefab, const D3DXMATRIX* const rootMatrix)
+{
+    this->prefab       = std::move(prefab);
+    this->bWorldDirty  = true;
+    this->worldVersion = 0;
+
+    if (!this->prefab)
+    {
+        OutputDebugFormat("TransformPrefabInstance.TransformPrefabInstance : prefab is nullptr.\n");
+        this->prefab = TransformPrefab::Create({}, {});
+    }
+
+    this->SetRootMatrix(rootMatrix);
+}
+
+TransformPrefabInstance::~TransformPrefabInstance()
+{
+}
+
+const std::shared_ptr<const TransformPrefab>& TransformPrefabInstance::GetPrefab() const
+{
+    return this->prefab;
+}
+
+size_t TransformPrefabInstance::GetNodeCount() const
+{
+    return this->prefab->GetNodeCount();
+}
+
+
+
+/**************************************** [Js ****************************************/
+
+const D3DXMATRIX& TransformPrefabInstance::GetLocalMatrix(size_t index) const
+{
+    if (this->IsOverridden(index)) return this->overrideMatrices[this->overrideSlots[index]];
+
+    return this->prefab->GetLocalMatrices()[index];
+}
+
+bool TransformPrefabInstance::SetLocalMatrix(size_t index, const D3DXMATRIX* const localMatrix)
+{
+    if (index >= this->prefab->GetNodeCount())
+    {
+        OutputDebugFormat("TransformPrefabInstance.SetLocalMatrix : index out of range.\n");
+        return false;
+    }
+    if (!localMatrix)
+    {
+        OutputDebugFormat("TransformPrefabInstance.SetLocalMatrix : localMatrix is nullptr.\n");
+        return false;
+    }
+
+    const Transform::MatrixClass matrixClass = Transform::ClassifyMatrix(localMatrix);
+
+    // ɎĂΏ㏑
+    if (this->IsOverridden(index))
+    {
+        const unsigned int slot = this->overrideSlots[index];
+        this->overrideMatrices[slot] = *localMatrix;
+        this->overrideClasses[slot]  = matrixClass;
+    }
+    // ߂Ă̏ŁÃm[h̕OŎ
+    else
+    {
+        if (this->overrideSlots.empty()) this->overrideSlots.assign(this->prefab->GetNodeCount(), TransformPrefabInstance::NoOverride);
+
+        this->overrideSlots[index] = static_cast<unsigned int>(this->overrideMatrices.size());
+        this->overrideMatrices.push_back(*localMatrix);
+        this->overrideClasses.push_back(matrixClass);
+        this->overrideNodes.push_back(static_cast<unsigned int>(index));
+    }
+
+    this->bWorldDirty = true;
+
+    return true;
+}
+
+bool TransformPrefabInstance::ResetLocalMatrix(size_t index)
+{
+    if (index >= this->prefab->GetNodeCount())
+    {
+        OutputDebugFormat("TransformPrefabInstance.ResetLocalMatrix : index out of range.\n");
+        return false;
+    }
+    if (!this->IsOverridden(index)) return true;
+
+    // 󂢂ʒuɈڂ
+    const unsigned int slot = this->overrideSlots[index];
+    const unsigned int last = static_cast<unsigned int>(this->overrideMatrices.size() - 1);
+
+    this->overrideMatrices[slot] = this->overrideMatrices[last];
+    this->overrideClasses[slot]  = this->overrideClasses[last];
+    this->overrideNodes[slot]    = this->overrideNodes[last];
+    this->overrideSlots[this->overrideNodes[slot]] = slot;
+
+    this->overrideMatrices.pop_back();
+    this->overrideClasses.pop_back();
+    this->overrideNodes.pop_back();
+    this->overrideSlots[index] = TransformPrefabInstance::NoOverride;
+
+    this->bWorldDirty = true;
+
+    return true;
+}
+
+void TransformPrefabInstance::ResetAllLocalMatrices()
+{
+    if (this->overrideMatrices.empty()) return;
+
+    // Săev[gɖ߂̂ŁAʒu̕\Ǝ̂Ă
+    std::vector<unsigned int>().swap(this->overrideSlots);
+    std::vector<D3DXMATRIX>().swap(this->overrideMatrices);
+    std::vector<Transform::MatrixClass>().swap(this->overrideClasses);
+    std::vector<unsigned int>().swap(this->overrideNodes);
+
+    this->bWorldDirty = true;
+}
+
+bool TransformPrefabInstance::IsOverridden(size_t index) const
+{
+    return index < this->overrideSlots.size() && this->overrideSlots[index] != TransformPrefabInstance::NoOverride;
+}
+
+size_t TransformPrefabInstance::GetOverrideCount() const
+{
+    return this->overrideMatrices.size();
+}
+
+
+
+/****************************************  ****************************************/
+
+void TransformPrefabInstance::SetRootMatrix(const D3DXMATRIX* const rootMatrix)
+{
+    if (rootMatrix)
+    {
+        this->rootMatrix = *rootMatrix;
+        this->rootClass  = Transform::ClassifyMatrix(rootMatrix);
+    }
+    else
+    {
+        D3DXMatrixIdentity(&this->rootMatrix);
+        this->rootClass = Transform::MatrixClass::Identity;
+    }
+
+    this->bWorldDirty = true;
+}
+
+const D3DXMATRIX& TransformPrefabInstance::GetRootMatrix() const
+{
+    return this->rootMatrix;
+}
+
+
+
+/**************************************** [hs ****************************************/
+
+size_t TransformPrefabInstance::UpdateWorldMatrices()
+{
+    if (!this->bWorldDirty) return 0;
+
+    TRANSFORM_TRACE_SCOPE("TransformPrefabInstance.UpdateWorldMatrices");
+
+    const size_t count = this->prefab->GetNodeCount();
+    this->worldMatrices.resize(count);
+    this->worldClasses.resize(count);
+
+    // m[h΁A猩sɍ̍s|邾
+    if (this->overrideMatrices.empty())
+    {
+        const std::span<const D3DXMATRIX>             relativeMatrices = this->prefab->GetRelativeMatrices();
+        const std::span<const Transform::MatrixClass> relativeClasses  = this->prefab->GetRelativeMatrixClasses();
+
+        TransformSimd::MultiplyMatrices(this->worldMatrices.data(), 1, relativeMatrices.data(), count, this->rootMatrix);
+        for (size_t i = 0; i < count; i++) this->worldClasses[i] = std::max(relativeClasses[i], this->rootClass);
+
+        this->bWorldDirty = false;
+        this->worldVersion++;
+
+        return count;
+    }
+
+    const std::span<const int>                    parentIndices = this->prefab->GetParentIndices();
+    const std::span<const D3DXMATRIX>             localMatrices = this->prefab->GetLocalMatrices();
+    const std::span<const Transform::MatrixClass> localClasses  = this->prefab->GetLocalMatrixClasses();
+
+    // Kw ( e͕Kq )
+    for (const unsigned int node : this->prefab->GetOrder())
+    {
+        const int parentIndex = parentIndices[node];
+
+        const D3DXMATRIX&            parentMatrix = (parentIndex < 0) ? this->rootMatrix : this->worldMatrices[parentIndex];
+        const Transform::MatrixClass parentClass  = (parentIndex < 0) ? this->rootClass  : this->worldClasses[parentIndex];
+
+        // O̍s񂪂΂
+        const unsigned int slot = this->overrideSlots[node];
+
+        const D3DXMATRIX&            localMatrix = (slot != TransformPrefabInstance::NoOverride) ? this->overrideMatrices[slot] : localMatrices[node];
+        const Transform::MatrixClass localClass  = (slot != TransformPrefabInstance::NoOverride) ? this->overrideClasses[slot]  : localClasses[node];
+
+        Transform::MultiplyByClass(&this->worldMatrices[node], localMatrix, localClass, parentMatrix, parentClass);
+        this->worldClasses[node] = std::max(localClass, parentClass);
+    }
+
+    this->bWorldDirty = false;
+    this->worldVersion++;
+
+    return count;
+}
+
+const D3DXMATRIX& TransformPrefabInstance::GetWorldMatrix(size_t index) const
+{
+    return this->worldMatrices[index];
+}
+
+std::span<const D3DXMATRIX> TransformPrefabInstance::GetWorldMatrices() const
+{
+    return this->worldMatrices;
+}
+
+bool TransformPrefabInstance::IsWorldMatrixDirty() const
+{
+    return this->bWorldDirty;
+}
+
+unsigned int TransformPrefabInstance::GetWorldVersion() const
+{
+    return this->worldVersion;
+}
+
+
+
+/**************************************** WJ ****************************************/
+
+bool TransformPrefabInstance::BuildTransforms(std::span<Transform* const> transforms) const
+{
+    const size_t count = this->prefab->GetNodeCount();
+    if (transforms.size() != count)
+    {
+        OutputDebugFormat("TransformPrefabInstance.BuildTransforms : transform count and node count differ.\n");
+        return false;
+    }
+
+    // ̃[Js ( O̍s񂪂΂ )
+    std::vector<D3DXMATRIX> localMatrices(count);
+    for (size_t i = 0; i < count; i++) localMatrices[i] = this->GetLocalMatrix(i);
+
+    return Transform::BuildHierarchy(transforms, this->prefab->GetParentIndices(), localMatrices);
+}
\ No newline at end of file
@@ -0,0 +1,249 @@
+#include <vector>
+#include <span>
+#include <memory>
+#include <d3dx9.h>
+#include "Transform.hpp"
+#pragma once
+
+/// <summary>
+/// Kwxzu邽߂̃ev[g ( e̔ԍƃ[Js )
+/// 쐬͕ύXłȂ̂ŁASẴCX^XňL
+/// </summary>
+class TransformPrefab
+{
+public:
+	/***** 쐬 *****/
+
+	/// <summary>
+	/// e̔ԍ̔z񂩂ev[g쐬 ( ނ͍s̒g画 )
+	/// m[h i ̐e̓m[h parentIndices[i] ( -1 ȂCX^X̍̍s񂪐e )
+	/// </summary>
+	/// <param name="parentIndices">	e̔ԍ </param>
+	/// <param name="localMatrices">	[Js ( parentIndices Ɠ ) </param>
+	/// <returns> ev[g ( s nullptr ) </returns>
+	static std::shared_ptr<const TransformPrefab> Create
+	(
+		std::span<const int>        parentIndices,
+		std::span<const D3DXMATRIX> localMatrices
+	);
+
+	/// <summary>
+	/// Transform ̕؂ev[g쐬 ( root m[h 0Aȍ~͊Kw )
+	/// root ̃[Jŝ܂܎̂ŁACX^X̍̍s root ̐ẽ[hsɂ
+	/// </summary>
+	/// <param name="root"> ؂̍ </param>
+	/// <returns> ev[g ( s nullptr ) </returns>
+	static std::shared_ptr<const TransformPrefab> CreateFromSubtree(const Transform* const root);
+
+public:
+	/***** 擾 *****/
+
+	// m[h
+	size_t GetNodeCount() const;
+
+	// e̔ԍ ( -1 Ȃ獪 )
+	std::span<const int> GetParentIndices() const;
+
+	// [Js
+	std::span<const D3DXMATRIX> GetLocalMatrices() const;
+
+	// [Js̕
+	std::span<const Transform::MatrixClass> GetLocalMatrixClasses() const;
+
+	// vZ鏇 ( e͕Kq )
+	std::span<const unsigned int> GetOrder() const;
+
+	// 猩s ( ̍s񂪒PʍŝƂ̃[hsA쐬ɈxvZ )
+	std::span<const D3DXMATRIX> GetRelativeMatrices() const;
+
+	// 猩s̕
+	std::span<const Transform::MatrixClass> GetRelativeMatrixClasses() const;
+
+public:
+	/***** CX^X *****/
+
+	//
+	// ؂𑽐̍ɒuƂ̃[hsA猩s * ̍s ̊|Zł܂Ƃ߂ČvZ
+	// ( eqH炸Am[hƂ̊|Z 1 A[JsCX^Xɂ͎gȂ )
+	// т bByNode = false ȂCX^X ( out[instance * m[h + node] )A
+	// true Ȃm[h ( out[node * CX^X + instance]Am[hƂɃCX^X`悷Ƃp )
+	//
+
+	/// <summary>
+	/// CX^X̃[hs܂Ƃ߂ČvZ
+	/// </summary>
+	/// <param name="instanceRoots">	CX^X̍̍s </param>
+	/// <param name="out">				[hs ( CX^X * m[h ȏ ) </param>
+	/// <param name="bByNode">			m[hƂɕׂ邩 (ftHg false) </param>
+	/// <returns>  </returns>
+	bool EvaluateInstances
+	(
+		std::span<const D3DXMATRIX> instanceRoots,
+		std::span<D3DXMATRIX>       out,
+		bool                        bByNode = false
+	) const;
+
+	/// <summary>
+	/// CX^X̃[hs܂Ƃ߂ČvZA]u 4x3 ŏo ( CX^Xobt@ɂ̂܂ܓn )
+	/// </summary>
+	/// <param name="instanceRoots">	CX^X̍̍s </param>
+	/// <param name="out">				float4 x 3 s ( CX^X * m[h * 12 ȏ ) </param>
+	/// <param name="bByNode">			m[hƂɕׂ邩 (ftHg false) </param>
+	/// <returns>  </returns>
+	bool EvaluateInstances4x3
+	(
+		std::span<const D3DXMATRIX> instanceRoots,
+		std::span<float>            out,
+		bool                        bByNode = false
+	) const;
+
+private:
+	TransformPrefab() = default;
+
+	// 쐬̖{ ( e̔ԍ؂ČvZ鏇Ԃ )
+	static std::shared_ptr<const TransformPrefab> CreateImpl
+	(
+		std::span<const int>                    parentIndices,
+		std::span<const D3DXMATRIX>             localMatrices,
+		std::span<const Transform::MatrixClass> classes
+	);
+
+private:
+	// e̔ԍ
+	std::vector<int> parentIndices;
+
+	// [Js ( parentIndices Ɠ )
+	std::vector<D3DXMATRIX> localMatrices;
+
+	// [Js̕
+	std::vector<Transform::MatrixClass> localClasses;
+
+	// vZ鏇 ( Kw )
+	std::vector<unsigned int> order;
+
+	// 猩sƕ ( parentIndices Ɠ )
+	std::vector<D3DXMATRIX>             relativeMatrices;
+	std::vector<Transform::MatrixClass> relativeClasses;
+};
+
+/// <summary>
+/// TransformPrefab QƂCX^X
+/// [Js͏߂ďm[hOŎ ( Rs[ICg )AȊO̓ev[gǂ
+/// [hs̓CX^XƂɎAUpdateWorldMatrices() ō̍s񂩂vZ
+/// ( m[h΁Aev[g̍猩sɍ̍s|邾 )
+///
+/// 쐬̓ev[g̎QƂƍ̍s񂾂ŁA[hs͏߂Ă̍XVŊmۂ
+/// </summary>
+class TransformPrefabInstance
+{
+public:
+	/***** ctor, dtor *****/
+	TransformPrefabInstance(std::shared_ptr<const TransformPrefab> prefab, const D3DXMATRIX* const rootMatrix = nullptr);
+	~TransformPrefabInstance();
+
+public:
+	/***** ev[g *****/
+
+	// ev[g擾
+	const std::shared_ptr<const TransformPrefab>& GetPrefab() const;
+
+	// m[h
+	size_t GetNodeCount() const;
+
+public:
+	/***** [Js *****/
+
+	// [Js擾 ( ĂȂ΃ev[g̍s )
+	const D3DXMATRIX& GetLocalMatrix(size_t index) const;
+
+	/// <summary>
+	/// [JsZbg ( ߂ĂȂÃm[h̍s񂾂OŎ )
+	/// </summary>
+	/// <param name="index">		m[h̔ԍ </param>
+	/// <param name="localMatrix">	[Js </param>
+	/// <returns>  </returns>
+	bool SetLocalMatrix(size_t index, const D3DXMATRIX* const localMatrix);
+
+	// [Jsev[gɖ߂ ( O̍ŝĂ )
+	bool ResetLocalMatrix(size_t index);
+
+	// SẴ[Jsev[gɖ߂
+	void ResetAllLocalMatrices();
+
+	// [JsOŎĂ邩
+	bool IsOverridden(size_t index) const;
+
+	// [JsOŎĂm[h̐
+	size_t GetOverrideCount() const;
+
+public:
+	/*****  *****/
+
+	// ̍s ( e -1 ̃m[h̐eɂAnullptr ŒPʍs ) Zbg
+	void SetRootMatrix(const D3DXMATRIX* const rootMatrix);
+
+	// ̍s擾
+	const D3DXMATRIX& GetRootMatrix() const;
+
+public:
+	/***** [hs *****/
+
+	/// <summary>
+	/// Sm[h̃[hsvZ ( ύXΉȂ )
+	/// </summary>
+	/// <returns> vZm[h̐ </returns>
+	size_t UpdateWorldMatrices();
+
+	// [hs擾 ( UpdateWorldMatrices() ̌ɌĂԂ )
+	const D3DXMATRIX& GetWorldMatrix(size_t index) const;
+
+	// Sm[h̃[hs ( ev[g̃m[h̕сAUpdateWorldMatrices() ̌ɌĂԂ )
+	std::span<const D3DXMATRIX> GetWorldMatrices() const;
+
+	// [hs񂪖XV
+	bool IsWorldMatrixDirty() const;
+
+	// [hs̔ ( vZтɑ )
+	unsigned int GetWorldVersion() const;
+
+public:
+	/***** WJ *****/
+
+	/// <summary>
+	/// ̃[Js Transform ̊KwgݗĂ ( ʂɓȂƂp )
+	/// ̃m[h̐e transforms ̍̐ê܂ ( ̍s͎gȂ )
+	/// </summary>
+	/// <param name="transforms"> gݗĂ Transform B ( m[hƓAe ) </param>
+	/// <returns>  </returns>
+	bool BuildTransforms(std::span<Transform* const> transforms) const;
+
+private:
+	// O̍sĂȂ
+	static constexpr unsigned int NoOverride = ~0u;
+
+private:
+	// ev[g
+	std::shared_ptr<const TransformPrefab> prefab;
+
+	// m[h -> O̍s̈ʒu ( ߂ď܂ŋ )
+	std::vector<unsigned int> overrideSlots;
+
+	// O̍sAށAm[h ( ʒuƁA߂Ƃ͖󂢂ʒuɈڂ )
+	std::vector<D3DXMATRIX>             overrideMatrices;
+	std::vector<Transform::MatrixClass> overrideClasses;
+	std::vector<unsigned int>           overrideNodes;
+
+	// ̍sƕ
+	D3DXMATRIX             rootMatrix;
+	Transform::MatrixClass rootClass;
+
+	// [hsƕ ( ߂Ă̍XVŊm )
+	std::vector<D3DXMATRIX>             worldMatrices;
+	std::vector<Transform::MatrixClass> worldClasses;
+
+	// [hs񂪖XV
+	bool bWorldDirty;
+
+	// [hs̔
+	unsigned int worldVersion;
+};
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include "TransformScheduler.hpp"
+#include "TransformTrace.hpp"
+
+TransformScheduler::TransformScheduler()
+{
+    this->frame = 0;
+}
+
+TransformScheduler::~TransformScheduler()
+{
+}
+
+/**************************************** o^ ****************************************/
+
+bool TransformScheduler::Register(Transform* const root, unsigned int interval)
+{
+    if (!root)
+    {
+        OutputDebugFormat("TransformScheduler.Register : root is nullptr.\n");
+        return false;
+    }
+
+    if (interval == 0) interval = 1;
+
+    // ؂̃m[h ( U蕪̏d )
+    size_t weight = 0;
+    std::vector<Transform*> stack;
+    stack.push_back(root);
+    while (!stack.empty())
+    {
+        Transform* const node = stack.back();
+        stack.pop_back();
+
+        weight++;
+        const auto children = node->GetChildren();
+        stack.insert(stack.end(), children.begin(), children.end());
+    }
+
+    // ɓo^ĂΊԊuύX
+    Entry* entry = this->Find(root);
+    if (entry)
+    {
+        entry->weight   = 0; // gׂ͕ɐȂ
+        entry->phase    = this->ChoosePhase(interval);
+        entry->interval = interval;
+        entry->weight   = weight;
+        return true;
+    }
+
+    this->entries.push_back({ root, interval, this->ChoosePhase(interval), weight });
+
+    root->SetUpdateThrottled(true);
+
+    return true;
+}
+
+bool TransformScheduler::Unregister(Transform* const root)
+{
+    for (auto it = this->entries.begin(); it != this->entries.end(); ++it)
+    {
+        if (it->root != root) continue;
+
+        this->entries.erase(it);
+
+        // Ԉ߂āA܂ĂύX𔽉f
+        root->SetUpdateThrottled(false);
+        root->PropagateWorldMatrix();
+
+        return true;
+    }
+
+    return false;
+}
+
+unsigned int TransformScheduler::GetInterval(Transform* const root) const
+{
+    const Entry* entry = this->Find(root);
+    return entry ? entry->interval : 0;
+}
+
+size_t TransformScheduler::GetRootCount() const
+{
+    return this->entries.size();
+}
+
+
+
+/**************************************** XV ****************************************/
+
+size_t TransformScheduler::Update()
+{
+    TRANSFORM_TRACE_SCOPE("TransformScheduler.Update");
+
+    this->frame++;
+
+    size_t updated = 0;
+    for (const Entry& entry : this->entries)
+    {
+        if (this->frame % entry.interval != entry.phase) continue;
+
+        entry.root->PropagateWorldMatrix();
+        updated++;
+    }
+
+    return updated;
+}
+
+void TransformScheduler::UpdateAll()
+{
+    for (const Entry& entry : this->entries)
+    {
+        entry.root->PropagateWorldMatrix();
+    }
+}
+
+unsigned long long TransformScheduler::GetFrame() const
+{
+    return this->frame;
+}
+
+
+
+/****************************************  ****************************************/
+
+unsigned int TransformScheduler::ChoosePhase(unsigned int interval) const
+{
+    // Ԋu̍́At[Ƃ̃m[h
+    std::vector<size_t> loads(interval, 0);
+    for (const Entry& entry : this->entries)
+    {
+        if (entry.interval == interval) loads[entry.phase] += entry.weight;
+    }
+
+    unsigned int phase = 0;
+    for (unsigned int i = 1; i < interval; i++)
+    {
+        if (loads[i] < loads[phase]) phase = i;
+    }
+
+    return phase;
+}
+
+TransformScheduler::Entry* TransformScheduler::Find(Transform* const root)
+{
+    for (Entry& entry : this->entries)
+    {
+        if (entry.root == root) return &entry;
+    }
+    return nullptr;
+}
+
+const TransformScheduler::Entry* TransformScheduler::Find(Transform* const root) const
+{
+    for (const Entry& entry : this->entries)
+    {
+        if (entry.root == root) return &entry;
+    }
+    return nullptr;
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include <vector>
+#include "Transform.hpp"
+#pragma once
+
+/// <summary>
+/// ̌QOȂǁADx̒Ⴂ؂̃[hs̍XV𐔃t[ɈɊԈ
+/// o^̕؂͕ύXĂ`dAUpdate() ̏ԂƂɂ܂Ƃ߂ČvZ
+/// Ԋu̍̓m[hϓɂȂ悤Ƀt[ɐU蕪 ( Ehr )
+/// Ԃ̑Oł GetWorldMatrix() œǂ߂΂̏ŌvZ
+/// 
+/// o^ Transform jO Unregister() 邱
+/// </summary>
+class TransformScheduler
+{
+public:
+	/***** ctor, dtor *****/
+	TransformScheduler();
+	~TransformScheduler();
+
+public:
+	/***** o^ *****/
+
+	/// <summary>
+	/// ؂̍o^ ( ؂͊ԈɂȂA͊ԊuύX )
+	/// </summary>
+	/// <param name="root">		؂̍ </param>
+	/// <param name="interval">	t[ɈXV邩 ( 1 Ŗt[ ) </param>
+	/// <returns> o^ł </returns>
+	bool Register(Transform* const root, unsigned int interval);
+
+	// o^ ( Ԉ߂āAɍXV )
+	bool Unregister(Transform* const root);
+
+	// XV̊Ԋu擾 ( o^ĂȂ 0 )
+	unsigned int GetInterval(Transform* const root) const;
+
+	// o^Ă鍪̐
+	size_t GetRootCount() const;
+
+public:
+	/***** XV *****/
+
+	/// <summary>
+	/// t[i߂āAԂ؂XV ( t[Ă )
+	/// </summary>
+	/// <returns> XV؂̐ </returns>
+	size_t Update();
+
+	// SĂ̕؂XV ( Ԃ͕ςȂ )
+	void UpdateAll();
+
+	// ̃t[
+	unsigned long long GetFrame() const;
+
+private:
+	// o^ꂽ
+	struct Entry
+	{
+		Transform*   root;
+		unsigned int interval;
+		unsigned int phase;		// frame % interval == phase ̃t[ōXV
+		size_t       weight;	// o^̃m[h
+	};
+
+private:
+	// ׂԏt[I
+	unsigned int ChoosePhase(unsigned int interval) const;
+
+	// o^ꂽT
+	Entry* Find(Transform* const root);
+	const Entry* Find(Transform* const root) const;
+
+private:
+	// o^ꂽ
+	std::vector<Entry> entries;
+
+	// ̃t[
+	unsigned long long frame;
+};
\ No newline at end of file
@@ -0,0 +1,379 @@
+#include <d3dx9.h>
+#pragma once
+
+// SSE g邩 ( x64A/arch:SSE ȏ x86Agcc / clang  -msse )
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1) || defined(__SSE__)
+#define TRANSFORM_SIMD_SSE
+#include <xmmintrin.h>
+#endif
+
+// SSE2 g邩 ( x64A/arch:SSE2 ȏ x86Agcc / clang  -msse2 )
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define TRANSFORM_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+// AVX2  FMA g邩 ( /arch:AVX2  FMA ܂ށAgcc / clang  -mavx2 -mfma  -march=haswell ȍ~ )
+// Ϙa _mm256_fmadd_ps ĝŁA-mavx2 Ȃ SSE ̂܂
+#if defined(TRANSFORM_SIMD_SSE) && defined(__AVX2__) && (defined(_MSC_VER) || defined(__FMA__))
+#define TRANSFORM_SIMD_AVX2
+#include <immintrin.h>
+#endif
+
+/// <summary>
+/// Transform Ŏg SIMD ̏ ( SSE  D3DX ŌvZ )
+/// </summary>
+struct TransformSimd
+{
+	/// <summary>
+	/// out = a * b ( sxNgAout  a, b Ɠł悢 )
+	/// </summary>
+	static void MultiplyMatrix(D3DXMATRIX* const out, const D3DXMATRIX& a, const D3DXMATRIX& b)
+	{
+#ifdef TRANSFORM_SIMD_SSE
+		const __m128 b0 = _mm_loadu_ps(&b._11);
+		const __m128 b1 = _mm_loadu_ps(&b._21);
+		const __m128 b2 = _mm_loadu_ps(&b._31);
+		const __m128 b3 = _mm_loadu_ps(&b._41);
+
+		__m128 rows[4];
+		for (int i = 0; i < 4; i++)
+		{
+			const float* const row = &a._11 + i * 4;
+
+			rows[i] = _mm_add_ps
+			(
+				_mm_add_ps(_mm_mul_ps(_mm_set1_ps(row[0]), b0), _mm_mul_ps(_mm_set1_ps(row[1]), b1)),
+				_mm_add_ps(_mm_mul_ps(_mm_set1_ps(row[2]), b2), _mm_mul_ps(_mm_set1_ps(row[3]), b3))
+			);
+		}
+
+		_mm_storeu_ps(&out->_11, rows[0]);
+		_mm_storeu_ps(&out->_21, rows[1]);
+		_mm_storeu_ps(&out->_31, rows[2]);
+		_mm_storeu_ps(&out->_41, rows[3]);
+#else
+		D3DXMATRIX result;
+		D3DXMatrixMultiply(&result, &a, &b);
+		*out = result;
+#endif
+	}
+
+	/// <summary>
+	/// ]u 4x3 ( float4 x 3 s ) ŏo ( 4 ڂ͎̂ĂAVF[_[ float4x3 p )
+	/// </summary>
+	static void StoreTransposed4x3(float* const out, const D3DXMATRIX& m)
+	{
+#ifdef TRANSFORM_SIMD_SSE
+		__m128 r0 = _mm_loadu_ps(&m._11);
+		__m128 r1 = _mm_loadu_ps(&m._21);
+		__m128 r2 = _mm_loadu_ps(&m._31);
+		__m128 r3 = _mm_loadu_ps(&m._41);
+
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+		_mm_storeu_ps(out + 0, r0);
+		_mm_storeu_ps(out + 4, r1);
+		_mm_storeu_ps(out + 8, r2);
+#else
+		for (int column = 0; column < 3; column++)
+		{
+			out[column * 4 + 0] = m.m[0][column];
+			out[column * 4 + 1] = m.m[1][column];
+			out[column * 4 + 2] = m.m[2][column];
+			out[column * 4 + 3] = m.m[3][column];
+		}
+#endif
+	}
+
+	/// <summary>
+	/// s̔zɂ܂Ƃ߂ēs| ( out[i * outStride] = a[i] * bAb ͈xǂݍ )
+	/// AVX2 Ȃ 2 svZAout  a ƏdȂȂ
+	/// </summary>
+	/// <param name="out">			 </param>
+	/// <param name="outStride">	ʂ̊Ԋu ( s̐Al߂Ȃ 1 ) </param>
+	/// <param name="a">			̍s̔z </param>
+	/// <param name="count">		 </param>
+	/// <param name="b">			E|s </param>
+	static void MultiplyMatrices(D3DXMATRIX* const out, size_t outStride, const D3DXMATRIX* const a, size_t count, const D3DXMATRIX& b)
+	{
+#if defined(TRANSFORM_SIMD_AVX2)
+		// s㉺ 128bit ɕׁA2 s̗vfxɍL
+		const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&b._11));
+		const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&b._21));
+		const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&b._31));
+		const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&b._41));
+
+		for (size_t i = 0; i < count; i++)
+		{
+			const float* const in  = &a[i]._11;
+			float*       const dst = &out[i * outStride]._11;
+
+			for (int half = 0; half < 2; half++)
+			{
+				const __m256 rows = _mm256_loadu_ps(in + half * 8);
+
+				__m256 result = _mm256_mul_ps(_mm256_permute_ps(rows, 0x00), b0);
+				result = _mm256_fmadd_ps(_mm256_permute_ps(rows, 0x55), b1, result);
+				result = _mm256_fmadd_ps(_mm256_permute_ps(rows, 0xAA), b2, result);
+				result = _mm256_fmadd_ps(_mm256_permute_ps(rows, 0xFF), b3, result);
+
+				_mm256_storeu_ps(dst + half * 8, result);
+			}
+		}
+#elif defined(TRANSFORM_SIMD_SSE)
+		const __m128 b0 = _mm_loadu_ps(&b._11);
+		const __m128 b1 = _mm_loadu_ps(&b._21);
+		const __m128 b2 = _mm_loadu_ps(&b._31);
+		const __m128 b3 = _mm_loadu_ps(&b._41);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			const float* const in  = &a[i]._11;
+			float*       const dst = &out[i * outStride]._11;
+
+			for (int row = 0; row < 4; row++)
+			{
+				const __m128 r = _mm_loadu_ps(in + row * 4);
+
+				_mm_storeu_ps
+				(
+					dst + row * 4,
+					_mm_add_ps
+					(
+						_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(r, r, 0x00), b0), _mm_mul_ps(_mm_shuffle_ps(r, r, 0x55), b1)),
+						_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(r, r, 0xAA), b2), _mm_mul_ps(_mm_shuffle_ps(r, r, 0xFF), b3))
+					)
+				);
+			}
+		}
+#else
+		for (size_t i = 0; i < count; i++) D3DXMatrixMultiply(&out[i * outStride], &a[i], &b);
+#endif
+	}
+
+	/// <summary>
+	/// s̔zɂ܂Ƃ߂ēs|A]u 4x3 ŏo ( CX^Xobt@pA4 ڂ͎̂Ă )
+	/// </summary>
+	/// <param name="out">			 ( 1 ɂ float 12  ) </param>
+	/// <param name="outStride">	ʂ̊Ԋu ( float ̐Al߂Ȃ 12 ) </param>
+	/// <param name="a">			̍s̔z </param>
+	/// <param name="count">		 </param>
+	/// <param name="b">			E|s </param>
+	static void MultiplyMatrices4x3(float* const out, size_t outStride, const D3DXMATRIX* const a, size_t count, const D3DXMATRIX& b)
+	{
+#ifdef TRANSFORM_SIMD_SSE
+		const __m128 b0 = _mm_loadu_ps(&b._11);
+		const __m128 b1 = _mm_loadu_ps(&b._21);
+		const __m128 b2 = _mm_loadu_ps(&b._31);
+		const __m128 b3 = _mm_loadu_ps(&b._41);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			const float* const in = &a[i]._11;
+
+			__m128 rows[4];
+			for (int row = 0; row < 4; row++)
+			{
+				const __m128 r = _mm_loadu_ps(in + row * 4);
+
+				rows[row] = _mm_add_ps
+				(
+					_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(r, r, 0x00), b0), _mm_mul_ps(_mm_shuffle_ps(r, r, 0x55), b1)),
+					_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(r, r, 0xAA), b2), _mm_mul_ps(_mm_shuffle_ps(r, r, 0xFF), b3))
+				);
+			}
+
+			_MM_TRANSPOSE4_PS(rows[0], rows[1], rows[2], rows[3]);
+
+			float* const dst = out + i * outStride;
+			_mm_storeu_ps(dst + 0, rows[0]);
+			_mm_storeu_ps(dst + 4, rows[1]);
+			_mm_storeu_ps(dst + 8, rows[2]);
+		}
+#else
+		for (size_t i = 0; i < count; i++)
+		{
+			D3DXMATRIX result;
+			D3DXMatrixMultiply(&result, &a[i], &b);
+			TransformSimd::StoreTransposed4x3(out + i * outStride, result);
+		}
+#endif
+	}
+
+	/// <summary>
+	/// WA̔zsŕϊ ( AoSAout  in Ɠł悢 )
+	/// W D3DXVec3TransformCoordA D3DXVec3TransformNormal Ɠ ( ˉe̖sȂ w ̊Z͏Ȃ )
+	/// </summary>
+	/// <param name="out">		 </param>
+	/// <param name="in">		ϊz </param>
+	/// <param name="count">	 </param>
+	/// <param name="m">		s </param>
+	/// <param name="bPoint">	WȂ true ( sړ܂߂ )AȂ false </param>
+	static void TransformVectors(D3DXVECTOR3* const out, const D3DXVECTOR3* const in, size_t count, const D3DXMATRIX& m, bool bPoint)
+	{
+		const bool bProjective = bPoint && TransformSimd::IsProjective(m);
+
+#ifdef TRANSFORM_SIMD_SSE
+		const __m128 r0 = _mm_loadu_ps(&m._11);
+		const __m128 r1 = _mm_loadu_ps(&m._21);
+		const __m128 r2 = _mm_loadu_ps(&m._31);
+		const __m128 r3 = bPoint ? _mm_loadu_ps(&m._41) : _mm_setzero_ps();
+
+		for (size_t i = 0; i < count; i++)
+		{
+			// ޑOɓǂ ( in  out ł悢悤 )
+			__m128 v = _mm_add_ps
+			(
+				_mm_add_ps(_mm_mul_ps(_mm_set1_ps(in[i].x), r0), _mm_mul_ps(_mm_set1_ps(in[i].y), r1)),
+				_mm_add_ps(_mm_mul_ps(_mm_set1_ps(in[i].z), r2), r3)
+			);
+
+			if (bProjective) v = _mm_div_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)));
+
+			// xyz  ( ̗vf󂳂Ȃ )
+			_mm_storel_pi(reinterpret_cast<__m64*>(&out[i].x), v);
+			_mm_store_ss(&out[i].z, _mm_movehl_ps(v, v));
+		}
+#else
+		for (size_t i = 0; i < count; i++)
+		{
+			const D3DXVECTOR3 v = in[i];
+			TransformSimd::TransformOne(&out[i].x, &out[i].y, &out[i].z, v.x, v.y, v.z, m, bPoint, bProjective);
+		}
+#endif
+	}
+
+	/// <summary>
+	/// WA̔zsŕϊ ( SoAAx, y, z ʁX̔zAout  in Ɠł悢 )
+	/// AVX2 Ȃ 8 ASSE Ȃ 4 vZ
+	/// </summary>
+	static void TransformVectorsSoA
+	(
+		float*       const outX,
+		float*       const outY,
+		float*       const outZ,
+		const float* const x,
+		const float* const y,
+		const float* const z,
+		size_t             count,
+		const D3DXMATRIX&  m,
+		bool               bPoint
+	)
+	{
+		const bool bProjective = bPoint && TransformSimd::IsProjective(m);
+		const float w = bPoint ? 1.0f : 0.0f;
+
+		size_t i = 0;
+
+#if defined(TRANSFORM_SIMD_AVX2)
+		{
+			const __m256 m11 = _mm256_set1_ps(m._11), m12 = _mm256_set1_ps(m._12), m13 = _mm256_set1_ps(m._13), m14 = _mm256_set1_ps(m._14);
+			const __m256 m21 = _mm256_set1_ps(m._21), m22 = _mm256_set1_ps(m._22), m23 = _mm256_set1_ps(m._23), m24 = _mm256_set1_ps(m._24);
+			const __m256 m31 = _mm256_set1_ps(m._31), m32 = _mm256_set1_ps(m._32), m33 = _mm256_set1_ps(m._33), m34 = _mm256_set1_ps(m._34);
+			const __m256 m41 = _mm256_set1_ps(m._41 * w), m42 = _mm256_set1_ps(m._42 * w), m43 = _mm256_set1_ps(m._43 * w), m44 = _mm256_set1_ps(m._44);
+
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256 vx = _mm256_loadu_ps(x + i);
+				const __m256 vy = _mm256_loadu_ps(y + i);
+				const __m256 vz = _mm256_loadu_ps(z + i);
+
+				__m256 rx = _mm256_fmadd_ps(vx, m11, _mm256_fmadd_ps(vy, m21, _mm256_fmadd_ps(vz, m31, m41)));
+				__m256 ry = _mm256_fmadd_ps(vx, m12, _mm256_fmadd_ps(vy, m22, _mm256_fmadd_ps(vz, m32, m42)));
+				__m256 rz = _mm256_fmadd_ps(vx, m13, _mm256_fmadd_ps(vy, m23, _mm256_fmadd_ps(vz, m33, m43)));
+
+				if (bProjective)
+				{
+					const __m256 rw = _mm256_fmadd_ps(vx, m14, _mm256_fmadd_ps(vy, m24, _mm256_fmadd_ps(vz, m34, m44)));
+					rx = _mm256_div_ps(rx, rw);
+					ry = _mm256_div_ps(ry, rw);
+					rz = _mm256_div_ps(rz, rw);
+				}
+
+				_mm256_storeu_ps(outX + i, rx);
+				_mm256_storeu_ps(outY + i, ry);
+				_mm256_storeu_ps(outZ + i, rz);
+			}
+		}
+#endif
+
+#if defined(TRANSFORM_SIMD_SSE)
+		{
+			const __m128 m11 = _mm_set1_ps(m._11), m12 = _mm_set1_ps(m._12), m13 = _mm_set1_ps(m._13), m14 = _mm_set1_ps(m._14);
+			const __m128 m21 = _mm_set1_ps(m._21), m22 = _mm_set1_ps(m._22), m23 = _mm_set1_ps(m._23), m24 = _mm_set1_ps(m._24);
+			const __m128 m31 = _mm_set1_ps(m._31), m32 = _mm_set1_ps(m._32), m33 = _mm_set1_ps(m._33), m34 = _mm_set1_ps(m._34);
+			const __m128 m41 = _mm_set1_ps(m._41 * w), m42 = _mm_set1_ps(m._42 * w), m43 = _mm_set1_ps(m._43 * w), m44 = _mm_set1_ps(m._44);
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128 vx = _mm_loadu_ps(x + i);
+				const __m128 vy = _mm_loadu_ps(y + i);
+				const __m128 vz = _mm_loadu_ps(z + i);
+
+				__m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m11), _mm_mul_ps(vy, m21)), _mm_add_ps(_mm_mul_ps(vz, m31), m41));
+				__m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m12), _mm_mul_ps(vy, m22)), _mm_add_ps(_mm_mul_ps(vz, m32), m42));
+				__m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m13), _mm_mul_ps(vy, m23)), _mm_add_ps(_mm_mul_ps(vz, m33), m43));
+
+				if (bProjective)
+				{
+					const __m128 rw = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m14), _mm_mul_ps(vy, m24)), _mm_add_ps(_mm_mul_ps(vz, m34), m44));
+					rx = _mm_div_ps(rx, rw);
+					ry = _mm_div_ps(ry, rw);
+					rz = _mm_div_ps(rz, rw);
+				}
+
+				_mm_storeu_ps(outX + i, rx);
+				_mm_storeu_ps(outY + i, ry);
+				_mm_storeu_ps(outZ + i, rz);
+			}
+		}
+#endif
+
+		// [
+		for (; i < count; i++)
+		{
+			TransformSimd::TransformOne(&outX[i], &outY[i], &outZ[i], x[i], y[i], z[i], m, bPoint, bProjective);
+		}
+	}
+
+private:
+	// ˉe܂ނ ( 4 ڂ (0, 0, 0, 1) łȂ )
+	static bool IsProjective(const D3DXMATRIX& m)
+	{
+		return m._14 != 0.0f || m._24 != 0.0f || m._34 != 0.0f || m._44 != 1.0f;
+	}
+
+	// 1 ϊ ( SIMD ̒[ASSE Ƃ )
+	static void TransformOne
+	(
+		float* const      outX,
+		float* const      outY,
+		float* const      outZ,
+		float             x,
+		float             y,
+		float             z,
+		const D3DXMATRIX& m,
+		bool              bPoint,
+		bool              bProjective
+	)
+	{
+		const float w = bPoint ? 1.0f : 0.0f;
+
+		float rx = x * m._11 + y * m._21 + z * m._31 + w * m._41;
+		float ry = x * m._12 + y * m._22 + z * m._32 + w * m._42;
+		float rz = x * m._13 + y * m._23 + z * m._33 + w * m._43;
+
+		if (bProjective)
+		{
+			const float rw = x * m._14 + y * m._24 + z * m._34 + m._44;
+			rx /= rw;
+			ry /= rw;
+			rz /= rw;
+		}
+
+		*outX = rx;
+		*outY = ry;
+		*outZ = rz;
+	}
+};
\ No newline at end of file
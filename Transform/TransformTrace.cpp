@@ -0,0 +1,160 @@
+#include "TransformTrace.hpp"
+#include <cstdio>
+#include <memory>
+#include "utils.hpp"
+
+namespace
+{
+    // Oobt@ 1 
+    struct Slot
+    {
+        // ݒ͊AI ( ʂԍ + 1 ) * 2 ( 0 Ȃ疢gp )
+        std::atomic<unsigned long long> sequence = 0;
+
+        const char*        name      = nullptr;
+        unsigned long long beginTime = 0;
+        unsigned long long endTime   = 0;
+        unsigned int       threadId  = 0;
+    };
+
+    std::atomic<bool>               enabled = true;
+    std::atomic<unsigned long long> writeIndex = 0;
+    std::atomic<unsigned int>       nextThreadId = 1;
+
+    // ߂ĎgƂɊm ( L^Ȃrhł̓gȂ )
+    Slot* GetSlots()
+    {
+        static std::unique_ptr<Slot[]> slots(new Slot[TransformTrace::Capacity]);
+        return slots.get();
+    }
+
+    // Xbh̔ԍ ( 1 珇 )
+    unsigned int GetThreadId()
+    {
+        thread_local const unsigned int id = nextThreadId++;
+        return id;
+    }
+
+    // JSON ̕ɓ悤 ( O͎ʎqxz )
+    void AppendEscaped(std::string* const out, const char* text)
+    {
+        for (; *text; text++)
+        {
+            if (*text == '"' || *text == '\\') out->push_back('\\');
+            out->push_back(*text);
+        }
+    }
+}
+
+void TransformTrace::SetEnabled(bool bEnabled)
+{
+    enabled.store(bEnabled, std::memory_order_relaxed);
+}
+
+bool TransformTrace::IsEnabled()
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+void TransformTrace::Clear()
+{
+    Slot* const slots = GetSlots();
+    for (size_t i = 0; i < TransformTrace::Capacity; i++) slots[i].sequence.store(0, std::memory_order_relaxed);
+
+    writeIndex.store(0, std::memory_order_release);
+}
+
+void TransformTrace::Record(const char* const name, unsigned long long beginTime, unsigned long long endTime)
+{
+    if (!TransformTrace::IsEnabled()) return;
+
+    // ʒu ( ÂԂ㏑ )
+    const unsigned long long index = writeIndex.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = GetSlots()[index % TransformTrace::Capacity];
+
+    // ݒ̈  g  Ï ( ǂޑ͑Ö󂪓Ƃg )
+    slot.sequence.store(index * 2 + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.name      = name;
+    slot.beginTime = beginTime;
+    slot.endTime   = endTime;
+    slot.threadId  = GetThreadId();
+
+    slot.sequence.store(index * 2 + 2, std::memory_order_release);
+}
+
+unsigned long long TransformTrace::GetTime()
+{
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
+std::string TransformTrace::ExportChromeTrace()
+{
+    Slot* const slots = GetSlots();
+
+    const unsigned long long end   = writeIndex.load(std::memory_order_acquire);
+    const unsigned long long begin = (end > TransformTrace::Capacity) ? end - TransformTrace::Capacity : 0;
+
+    std::string json = "{\"traceEvents\":[";
+    bool bFirst = true;
+
+    for (unsigned long long index = begin; index < end; index++)
+    {
+        const Slot& slot = slots[index % TransformTrace::Capacity];
+
+        // IĂāAǂފԂɏ㏑ȂԂ
+        const unsigned long long sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != index * 2 + 2) continue;
+
+        const char* const        name      = slot.name;
+        const unsigned long long beginTime = slot.beginTime;
+        const unsigned long long endTime   = slot.endTime;
+        const unsigned int       threadId  = slot.threadId;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != sequence) continue;
+
+        // Cxg ( ph = X )A̓}CNb
+        char buffer[128];
+        snprintf
+        (
+            buffer, sizeof(buffer),
+            "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+            beginTime / 1000.0,
+            (endTime - beginTime) / 1000.0,
+            threadId
+        );
+
+        json += bFirst ? "\n{\"name\":\"" : ",\n{\"name\":\"";
+        AppendEscaped(&json, name ? name : "");
+        json += buffer;
+        bFirst = false;
+    }
+
+    json += "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return json;
+}
+
+bool TransformTrace::SaveChromeTrace(const char* const path)
+{
+    const std::string json = TransformTrace::ExportChromeTrace();
+
+    FILE* file = nullptr;
+#ifdef _MSC_VER
+    if (fopen_s(&file, path, "wb") != 0) file = nullptr;
+#else
+    file = fopen(path, "wb");
+#endif
+    if (!file)
+    {
+        OutputDebugFormat("TransformTrace.SaveChromeTrace : can not open file.\n");
+        return false;
+    }
+
+    const bool bWritten = fwrite(json.data(), 1, json.size(), file) == json.size();
+    fclose(file);
+
+    return bWritten;
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include <string>
+#include <atomic>
+#include <chrono>
+#pragma once
+
+/// <summary>
+/// Kw̍XV̋ԂL^ Chrome ̃g[X ( chrome://tracingAPerfetto )  JSON ŏo
+/// 
+/// TRANSFORM_ENABLE_TRACE `ărhƂ TRANSFORM_TRACE_SCOPE() L^ ( `Ȃ牽Ȃ )
+/// L^̓bN̖Oobt@ ( Â̂㏑ )Ao͋L^ƓɌĂł悢 ( ݒ̋Ԃ͔΂ )
+/// Ԃ̖O͕񃊃eȂǁAo܂Ŏc镶ɂ邱
+/// </summary>
+class TransformTrace
+{
+public:
+	// Oobt@ɎcԂ̐
+	static constexpr size_t Capacity = 1 << 16;
+
+	// L^̗LA ( sɐ؂ւATRANSFORM_ENABLE_TRACE ΈӖ͖ )
+	static void SetEnabled(bool bEnabled);
+	static bool IsEnabled();
+
+	// L^ ( L^̃XbhƂɌĂԂ )
+	static void Clear();
+
+	// ԂL^ (  GetTime() ̒l )
+	static void Record(const char* const name, unsigned long long beginTime, unsigned long long endTime);
+
+	// ̎ ( imb )
+	static unsigned long long GetTime();
+
+	// Chrome ̃g[X JSON  ( cĂԂÂ )
+	static std::string ExportChromeTrace();
+
+	/// <summary>
+	/// Chrome ̃g[X JSON t@C֏o
+	/// </summary>
+	/// <param name="path"> ot@C </param>
+	/// <returns> o </returns>
+	static bool SaveChromeTrace(const char* const path);
+};
+
+/// <summary>
+/// XR[v̊JnI܂łL^ ( TRANSFORM_TRACE_SCOPE() g )
+/// </summary>
+class TransformTraceScope
+{
+public:
+	TransformTraceScope(const char* const name) : name(name), beginTime(TransformTrace::IsEnabled() ? TransformTrace::GetTime() : 0) {}
+
+	~TransformTraceScope()
+	{
+		if (this->beginTime) TransformTrace::Record(this->name, this->beginTime, TransformTrace::GetTime());
+	}
+
+	TransformTraceScope(const TransformTraceScope&)            = delete;
+	TransformTraceScope& operator=(const TransformTraceScope&) = delete;
+
+private:
+	const char*        name;
+	unsigned long long beginTime;	// 0 ȂL^Ȃ
+};
+
+#define TRANSFORM_TRACE_CONCAT_INNER(a, b) a##b
+#define TRANSFORM_TRACE_CONCAT(a, b)       TRANSFORM_TRACE_CONCAT_INNER(a, b)
+
+// XR[v̋ԂL^ ( TRANSFORM_ENABLE_TRACE ΉȂ )
+#ifdef TRANSFORM_ENABLE_TRACE
+#define TRANSFORM_TRACE_SCOPE(name) TransformTraceScope TRANSFORM_TRACE_CONCAT(transformTraceScope, __LINE__)(name)
+#else
+#define TRANSFORM_TRACE_SCOPE(name) ((void)0)
+#endif
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include "WorldMatrixStaging.hpp"
+#include "TransformTrace.hpp"
+#include <cstdint>
+#include <algorithm>
+
+WorldMatrixStaging::WorldMatrixStaging()
+{
+}
+
+WorldMatrixStaging::~WorldMatrixStaging()
+{
+}
+
+/**************************************** o^ ****************************************/
+
+unsigned int WorldMatrixStaging::Register(Transform* const transform)
+{
+    if (!transform)
+    {
+        OutputDebugFormat("WorldMatrixStaging.Register : transform is nullptr.\n");
+        return WorldMatrixStaging::InvalidSlot;
+    }
+
+    unsigned int slot;
+
+    // 󂫃Xbgėp
+    if (!this->freeSlots.empty())
+    {
+        slot = this->freeSlots.back();
+        this->freeSlots.pop_back();
+        this->transforms[slot] = transform;
+    }
+    else
+    {
+        slot = static_cast<unsigned int>(this->transforms.size());
+        this->transforms.push_back(transform);
+        this->seenVersions.push_back(0);
+    }
+
+    // ł 1 n܂̂ŁA Collect() ŕKύXɂȂ
+    this->seenVersions[slot] = 0;
+
+    return slot;
+}
+
+bool WorldMatrixStaging::Unregister(unsigned int slot)
+{
+    if (slot >= this->transforms.size() || !this->transforms[slot]) return false;
+
+    this->transforms[slot]   = nullptr;
+    this->seenVersions[slot] = 0;
+    this->freeSlots.push_back(slot);
+
+    // Collect() ̌ɉꂽ珑oO ( Ȃ̂œ񕪒T )
+    const auto changed = std::lower_bound(this->changedSlots.begin(), this->changedSlots.end(), slot);
+    if (changed != this->changedSlots.end() && *changed == slot) this->changedSlots.erase(changed);
+
+    return true;
+}
+
+Transform* WorldMatrixStaging::GetTransform(unsigned int slot) const
+{
+    if (slot >= this->transforms.size()) return nullptr;
+
+    return this->transforms[slot];
+}
+
+size_t WorldMatrixStaging::GetSlotCount() const
+{
+    return this->transforms.size();
+}
+
+void WorldMatrixStaging::Invalidate()
+{
+    std::fill(this->seenVersions.begin(), this->seenVersions.end(), 0);
+}
+
+
+
+/**************************************** ύX̎WAo ****************************************/
+
+size_t WorldMatrixStaging::Collect()
+{
+    TRANSFORM_TRACE_SCOPE("WorldMatrixStaging.Collect");
+
+    this->changedSlots.clear();
+
+    // łׂ邾 ( sɂ͐GȂ )
+    const size_t count = this->transforms.size();
+    for (size_t i = 0; i < count; i++)
+    {
+        const Transform* const transform = this->transforms[i];
+        if (!transform) continue;
+
+        const unsigned int version = transform->GetWorldVersion();
+        if (version == this->seenVersions[i]) continue;
+
+        this->seenVersions[i] = version;
+        this->changedSlots.push_back(static_cast<unsigned int>(i));
+    }
+
+    return this->changedSlots.size();
+}
+
+const std::vector<unsigned int>& WorldMatrixStaging::GetChangedSlots() const
+{
+    return this->changedSlots;
+}
+
+size_t WorldMatrixStaging::WriteChanged(void* const buffer, size_t bufferSize, size_t first) const
+{
+    if (!buffer) return 0;
+
+    if (reinterpret_cast<std::uintptr_t>(buffer) % alignof(Entry) != 0)
+    {
+        OutputDebugFormat("WorldMatrixStaging.WriteChanged : buffer is not 16 byte aligned.\n");
+        return 0;
+    }
+
+    if (first >= this->changedSlots.size()) return 0;
+
+    const size_t capacity = bufferSize / sizeof(Entry);
+    const size_t count    = std::min(capacity, this->changedSlots.size() - first);
+
+    Entry* const entries = static_cast<Entry*>(buffer);
+    for (size_t i = 0; i < count; i++)
+    {
+        const unsigned int slot = this->changedSlots[first + i];
+
+        entries[i].index       = slot;
+        entries[i].reserved[0] = 0;
+        entries[i].reserved[1] = 0;
+        entries[i].reserved[2] = 0;
+        entries[i].matrix      = this->transforms[slot]->GetWorldMatrix();
+    }
+
+    return count;
+}
+
+size_t WorldMatrixStaging::WriteDirtyRanges(D3DXMATRIX* const matrices, size_t matrixCount, std::vector<Range>* const ranges, unsigned int maxGap) const
+{
+    if (!ranges) return 0;
+
+    ranges->clear();
+
+    if (!matrices) return 0;
+
+    if (matrixCount < this->transforms.size())
+    {
+        OutputDebugFormat("WorldMatrixStaging.WriteDirtyRanges : matrix array is smaller than slot count.\n");
+        return 0;
+    }
+
+    // ςXbg͏Ȃ̂ŁAׂ荇̂Ȃ
+    for (const unsigned int slot : this->changedSlots)
+    {
+        matrices[slot] = this->transforms[slot]->GetWorldMatrix();
+
+        if (!ranges->empty())
+        {
+            Range& last = ranges->back();
+            const unsigned int end = last.first + last.count;
+
+            if (slot <= end + maxGap)
+            {
+                last.count = slot + 1 - last.first;
+                continue;
+            }
+        }
+
+        ranges->push_back({ slot, 1 });
+    }
+
+    return ranges->size();
+}
\ No newline at end of file
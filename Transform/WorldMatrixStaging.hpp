@@ -0,0 +1,110 @@
+#include <vector>
+#include <d3dx9.h>
+#include "Transform.hpp"
+#pragma once
+
+/// <summary>
+/// O񂩂ς[hs񂾂 GPU ]p̃obt@ɏo
+/// ( Transform Xbgɓo^A[hs̔łׂĕύXo )
+/// 
+/// g : XVI Collect()  WriteChanged()  WriteDirtyRanges() ŏoAς]
+/// o^ Transform jO Unregister() 邱
+/// </summary>
+class WorldMatrixStaging
+{
+public:
+	// o 1  ( 16 byte EAVF[_[ł uint4 + float4x4 Ƃēǂ߂ )
+	struct alignas(16) Entry
+	{
+		unsigned int index;			// Xbgԍ
+		unsigned int reserved[3];	// 0 
+		D3DXMATRIX   matrix;		// [hs
+	};
+
+	// AύX͈ [ first, first + count )
+	struct Range
+	{
+		unsigned int first;
+		unsigned int count;
+	};
+
+	// ȃXbg
+	static constexpr unsigned int InvalidSlot = ~0u;
+
+public:
+	/***** ctor, dtor *****/
+	WorldMatrixStaging();
+	~WorldMatrixStaging();
+
+public:
+	/***** o^ *****/
+
+	/// <summary>
+	/// Transform o^ ( 󂢂Xbg΍ėpAo^͕ύX )
+	/// </summary>
+	/// <param name="transform"> o^ Transform </param>
+	/// <returns> Xbgԍ ( s InvalidSlot ) </returns>
+	unsigned int Register(Transform* const transform);
+
+	// o^ ( Xbg͋󂫂ɂȂACollect() ŏW߂ɂΊO )
+	bool Unregister(unsigned int slot);
+
+	// Xbg Transform 擾 ( 󂫂Ȃ nullptr )
+	Transform* GetTransform(unsigned int slot) const;
+
+	// Xbg ( 󂫂܂ށAtbgz̗vf )
+	size_t GetSlotCount() const;
+
+	// SXbgύXɂ ( GPU obt@蒼ƂȂ )
+	void Invalidate();
+
+public:
+	/***** ύX̎WAo *****/
+
+	/// <summary>
+	/// O Collect() 烏[hs񂪕ςXbgW߂ ( XbgԍAԈ Transform ͔łǂނƂɌvZ )
+	/// </summary>
+	/// <returns> ςXbg̐ </returns>
+	size_t Collect();
+
+	// Collect() ŏW߂Xbgԍ (  )
+	const std::vector<unsigned int>& GetChangedSlots() const;
+
+	/// <summary>
+	/// ς ( Xbgԍ, [hs ) ̋l߂Ƃďo
+	/// </summary>
+	/// <param name="buffer">		o ( 16 byte E ) </param>
+	/// <param name="bufferSize">	õoCg </param>
+	/// <param name="first">		ڂ珑o ( 肫Ȃ̑p ) </param>
+	/// <returns> o </returns>
+	size_t WriteChanged(void* const buffer, size_t bufferSize, size_t first = 0) const;
+
+	/// <summary>
+	/// ςXbgԍ̈ʒuɏA]ׂ͈͂Ԃ
+	/// </summary>
+	/// <param name="matrices">		Xbgԍňtbgz ( o ) </param>
+	/// <param name="matrixCount">	matrices ̗vf </param>
+	/// <param name="ranges">		]ׂ͈ ( ㏑ ) </param>
+	/// <param name="maxGap">		Ԃ̖ύX̐ȉȂ͈͂Ȃ ( ]񐔂炷 ) </param>
+	/// <returns> ͈͂̐ </returns>
+	size_t WriteDirtyRanges
+	(
+		D3DXMATRIX*         const matrices,
+		size_t                    matrixCount,
+		std::vector<Range>* const ranges,
+		unsigned int              maxGap = 0
+	) const;
+
+private:
+	// o^ꂽ Transform ( 󂫂 nullptr )
+	std::vector<Transform*> transforms;
+
+	// O񌩂[hs̔
+	std::vector<unsigned int> seenVersions;
+
+	// 󂫃Xbg
+	std::vector<unsigned int> freeSlots;
+
+	// ςXbg
+	std::vector<unsigned int> changedSlots;
+};
\ No newline at end of file